@@ -25,8 +25,67 @@
 
 #include <jsonifier/Simd/SimdTypes.hpp>
 #include <memory_resource>
+#include <limits>
+#include <new>
 #include <stdlib.h>
 
+namespace jsonifier {
+
+	/// @brief The allocator jsonifier's containers and scratch buffers use unless told otherwise: aligned malloc and free.
+	/// Any type with allocate(bytes, alignment) and deallocate(ptr, bytes, alignment) members can stand in for it, e.g. to draw from a jemalloc or
+	/// mimalloc arena, a hugepage pool or a per-core slab; jsonifier always asks for bytesPerStep alignment and passes back the byte count it asked for.
+	struct aligned_allocator {
+		JSONIFIER_INLINE static void* allocate(uint64_t bytes, uint64_t alignment) noexcept {
+#if JSONIFIER_PLATFORM_WINDOWS || JSONIFIER_PLATFORM_LINUX
+			return _mm_malloc(bytes, alignment);
+#else
+			return aligned_alloc(alignment, bytes);
+#endif
+		}
+
+		JSONIFIER_INLINE static void deallocate(void* ptr, uint64_t, uint64_t) noexcept {
+#if JSONIFIER_PLATFORM_WINDOWS || JSONIFIER_PLATFORM_LINUX
+			_mm_free(ptr);
+#else
+			free(ptr);
+#endif
+		}
+	};
+
+	/// @brief Draws from a std::pmr::memory_resource, such as a monotonic_buffer_resource or a pool, which must outlive everything allocated from it.
+	/// A resource that cannot satisfy a request, e.g. one over a caller's buffer with std::pmr::null_memory_resource() upstream, yields nullptr as
+	/// aligned_allocator does. jsonifier's string and vector then throw std::bad_alloc from the members that grow them, as the std containers do.
+	/// The scratch catches this and parseJson and validateJson report Capacity_Exceeded, but a failure while growing a parsed value or a serialized
+	/// buffer happens inside a noexcept call and ends in std::terminate.
+	class resource_allocator {
+	  public:
+		JSONIFIER_INLINE resource_allocator() noexcept = default;
+
+		JSONIFIER_INLINE resource_allocator(std::pmr::memory_resource* resourceNew) noexcept : resource{ resourceNew } {
+		}
+
+		JSONIFIER_INLINE void* allocate(uint64_t bytes, uint64_t alignment) noexcept {
+			try {
+				return resource->allocate(bytes, alignment);
+			} catch (const std::bad_alloc&) {
+				return nullptr;
+			}
+		}
+
+		JSONIFIER_INLINE void deallocate(void* ptr, uint64_t bytes, uint64_t alignment) noexcept {
+			resource->deallocate(ptr, bytes, alignment);
+		}
+
+		JSONIFIER_INLINE std::pmr::memory_resource* getResource() const noexcept {
+			return resource;
+		}
+
+	  protected:
+		std::pmr::memory_resource* resource{ std::pmr::get_default_resource() };
+	};
+
+}
+
 namespace jsonifier::internal {
 
 	template<typename value_type> JSONIFIER_INLINE constexpr value_type&& forward(jsonifier::internal::remove_reference_t<value_type>& value) noexcept {
@@ -60,31 +119,36 @@ namespace jsonifier::internal {
 		}
 	}
 
-	template<typename value_type_new> class alloc_wrapper {
+	/// @brief Hands an allocator's storage out as typed, bytesPerStep-aligned arrays. Containers derive from it, so an empty allocator costs them nothing
+	/// and a stateful one, such as an arena handle, travels with the storage it allocated.
+	template<typename value_type_new, typename allocator_type = aligned_allocator> class alloc_wrapper : protected allocator_type {
 	  public:
-		using value_type	   = value_type_new;
-		using pointer		   = value_type*;
-		using size_type		   = size_t;
-		using allocator_traits = std::allocator_traits<alloc_wrapper<value_type>>;
+		static_assert(
+			requires(allocator_type& allocator, void* ptr, uint64_t bytes) {
+				{ allocator.allocate(bytes, bytes) } -> std::convertible_to<void*>;
+				allocator.deallocate(ptr, bytes, bytes);
+			}, "Sorry, but a jsonifier allocator needs allocate(bytes, alignment) and deallocate(ptr, bytes, alignment) members.");
 
-		JSONIFIER_INLINE static pointer allocate(size_type count) noexcept {
+		using value_type = value_type_new;
+		using pointer	 = value_type*;
+		using size_type	 = size_t;
+
+		JSONIFIER_INLINE alloc_wrapper() noexcept = default;
+
+		JSONIFIER_INLINE explicit alloc_wrapper(const allocator_type& allocatorNew) noexcept : allocator_type{ allocatorNew } {
+		}
+
+		template<typename other_type = value_type> JSONIFIER_INLINE other_type* allocate(size_type count) noexcept {
 			if JSONIFIER_UNLIKELY (count == 0) {
 				return nullptr;
 			}
-#if JSONIFIER_PLATFORM_WINDOWS || JSONIFIER_PLATFORM_LINUX
-			return static_cast<value_type*>(_mm_malloc(roundUpToMultiple<bytesPerStep>(count * sizeof(value_type)), bytesPerStep));
-#else
-			return static_cast<value_type*>(aligned_alloc(bytesPerStep, roundUpToMultiple<bytesPerStep>(count * sizeof(value_type))));
-#endif
+			return static_cast<other_type*>(allocator_type::allocate(roundUpToMultiple<bytesPerStep>(count * sizeof(other_type)), bytesPerStep));
 		}
 
-		JSONIFIER_INLINE void deallocate(pointer ptr, size_t = 0) noexcept {
+		/// @brief Returns storage from allocate; count must be the count it was allocated with.
+		template<typename other_type> JSONIFIER_INLINE void deallocate(other_type* ptr, size_type count) noexcept {
 			if JSONIFIER_LIKELY (ptr) {
-#if JSONIFIER_PLATFORM_WINDOWS || JSONIFIER_PLATFORM_LINUX
-				_mm_free(ptr);
-#else
-				free(ptr);
-#endif
+				allocator_type::deallocate(ptr, roundUpToMultiple<bytesPerStep>(count * sizeof(other_type)), bytesPerStep);
 			}
 		}
 
@@ -92,13 +156,24 @@ namespace jsonifier::internal {
 			new (ptr) value_type(internal::forward<arg_types>(args)...);
 		}
 
-		JSONIFIER_INLINE static size_type maxSize() noexcept {
-			return allocator_traits::max_size(alloc_wrapper{});
+		JSONIFIER_INLINE static constexpr size_type maxSize() noexcept {
+			return std::numeric_limits<size_type>::max() / sizeof(value_type);
 		}
 
 		JSONIFIER_INLINE static void destroy(pointer ptr) noexcept {
 			ptr->~value_type();
 		}
+
+		JSONIFIER_INLINE const allocator_type& getAllocator() const noexcept {
+			return *this;
+		}
+
+	  protected:
+		JSONIFIER_INLINE void swapAllocator(alloc_wrapper& other) noexcept {
+			if constexpr (!std::is_empty_v<allocator_type>) {
+				std::swap(static_cast<allocator_type&>(*this), static_cast<allocator_type&>(other));
+			}
+		}
 	};
 
 }// namespace internal
\ No newline at end of file
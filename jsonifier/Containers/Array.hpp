@@ -61,11 +61,11 @@ namespace jsonifier::internal {
 		}
 
 		JSONIFIER_INLINE constexpr iterator end() noexcept {
-			return iterator(dataVal);
+			return iterator(dataVal + sizeNew);
 		}
 
 		JSONIFIER_INLINE constexpr const_iterator end() const noexcept {
-			return const_iterator(dataVal);
+			return const_iterator(dataVal + sizeNew);
 		}
 
 		JSONIFIER_INLINE constexpr reverse_iterator rbegin() noexcept {
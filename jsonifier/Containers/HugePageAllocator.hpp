@@ -0,0 +1,90 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Containers/Allocator.hpp>
+
+#if JSONIFIER_PLATFORM_LINUX
+	#include <sys/mman.h>
+#endif
+
+namespace jsonifier {
+
+	/// @brief Backs large buffers with 2 MiB pages, so a structural tape or string buffer of hundreds of MiB costs a few hundred TLB entries rather than
+	/// tens of thousands. Buffers of at least minHugePageBytes are mapped with MAP_HUGETLB when the system has explicit huge pages reserved, and
+	/// otherwise mapped on a 2 MiB boundary and marked MADV_HUGEPAGE for transparent huge pages; smaller buffers, and every buffer on platforms without
+	/// mmap, go to aligned_allocator. Use it as the allocator_type of jsonifier_core, scratch or a container, e.g. jsonifier_core<true, hugepage_allocator>.
+	struct hugepage_allocator {
+		static constexpr uint64_t hugePageSize{ 2 * 1024 * 1024 };
+		static constexpr uint64_t minHugePageBytes{ hugePageSize };
+
+		JSONIFIER_INLINE static void* allocate(uint64_t bytes, uint64_t alignment) noexcept {
+#if JSONIFIER_PLATFORM_LINUX
+			if (bytes >= minHugePageBytes) {
+				return mapHugePages(internal::roundUpToMultiple<hugePageSize>(bytes));
+			}
+#endif
+			return aligned_allocator::allocate(bytes, alignment);
+		}
+
+		JSONIFIER_INLINE static void deallocate(void* ptr, uint64_t bytes, uint64_t alignment) noexcept {
+#if JSONIFIER_PLATFORM_LINUX
+			if (bytes >= minHugePageBytes) {
+				::munmap(ptr, internal::roundUpToMultiple<hugePageSize>(bytes));
+				return;
+			}
+#endif
+			aligned_allocator::deallocate(ptr, bytes, alignment);
+		}
+
+	  protected:
+#if JSONIFIER_PLATFORM_LINUX
+		/// @brief Returns nullptr only when not even an ordinary anonymous mapping of mappedBytes can be made.
+		static void* mapHugePages(uint64_t mappedBytes) noexcept {
+	#if defined(MAP_HUGETLB)
+			if (void* ptr{ ::mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0) }; ptr != MAP_FAILED) {
+				return ptr;
+			}
+	#endif
+			void* base{ ::mmap(nullptr, mappedBytes + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+			if (base == MAP_FAILED) {
+				return nullptr;
+			}
+			char* const mappedStart{ static_cast<char*>(base) };
+			char* const alignedStart{ reinterpret_cast<char*>(internal::roundUpToMultiple<hugePageSize>(reinterpret_cast<uintptr_t>(mappedStart))) };
+			if (alignedStart > mappedStart) {
+				::munmap(mappedStart, static_cast<uint64_t>(alignedStart - mappedStart));
+			}
+			if (const uint64_t tailBytes{ hugePageSize - static_cast<uint64_t>(alignedStart - mappedStart) }; tailBytes > 0) {
+				::munmap(alignedStart + mappedBytes, tailBytes);
+			}
+	#if defined(MADV_HUGEPAGE)
+			::madvise(alignedStart, mappedBytes, MADV_HUGEPAGE);
+	#endif
+			return alignedStart;
+		}
+#endif
+	};
+
+}
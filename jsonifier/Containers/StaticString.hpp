@@ -0,0 +1,237 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Containers/Iterator.hpp>
+#include <jsonifier/Utilities/Compare.hpp>
+#include <stdexcept>
+#include <string_view>
+
+namespace jsonifier {
+
+	/// @brief A string whose characters live inline, in storage for fixedCapacity of them plus a terminating null, so it never allocates. Growing it
+	/// past fixedCapacity throws std::length_error; parseJson instead keeps the first fixedCapacity bytes, cut back to a whole utf-8 character, and
+	/// reports parse_errors::Capacity_Exceeded.
+	template<uint64_t capacityNew> class static_string {
+	  public:
+		using value_type			 = char;
+		using pointer				 = value_type*;
+		using const_pointer			 = const value_type*;
+		using reference				 = value_type&;
+		using const_reference		 = const value_type&;
+		using difference_type		 = std::ptrdiff_t;
+		using iterator				 = internal::basic_iterator<value_type>;
+		using const_iterator		 = internal::basic_iterator<const value_type>;
+		using reverse_iterator		 = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using size_type				 = uint64_t;
+
+		static constexpr size_type fixedCapacity{ capacityNew };
+		static constexpr size_type npos{ std::numeric_limits<size_type>::max() };
+
+		constexpr static_string() noexcept = default;
+
+		static_string(const_pointer other, size_type newSize) {
+			assign(other, newSize);
+		}
+
+		template<size_t size> static_string(const value_type (&other)[size]) {
+			assign(other, std::char_traits<value_type>::length(other));
+		}
+
+		template<concepts::string_t value_type_newer>
+			requires(!std::is_same_v<jsonifier::internal::remove_cvref_t<value_type_newer>, static_string>)
+		explicit static_string(const value_type_newer& other) {
+			assign(other.data(), other.size());
+		}
+
+		template<concepts::string_t value_type_newer>
+			requires(!std::is_same_v<jsonifier::internal::remove_cvref_t<value_type_newer>, static_string>)
+		static_string& operator=(const value_type_newer& other) {
+			assign(other.data(), other.size());
+			return *this;
+		}
+
+		void assign(const_pointer other, size_type newSize) {
+			checkCapacity(newSize);
+			std::memmove(dataVal, other, newSize);
+			sizeVal			 = newSize;
+			dataVal[sizeVal] = value_type{};
+		}
+
+		static_string substr(size_type position, size_type count = npos) const {
+			if JSONIFIER_UNLIKELY (position > sizeVal) {
+				throw std::out_of_range{ "Substring position is out of range." };
+			}
+			count = internal::min(count, sizeVal - position);
+			return static_string{ dataVal + position, count };
+		}
+
+		template<typename... arg_types> size_type find(arg_types&&... args) const noexcept {
+			return operator std::basic_string_view<value_type>().find(std::forward<arg_types>(args)...);
+		}
+
+		iterator begin() noexcept {
+			return iterator{ dataVal };
+		}
+
+		iterator end() noexcept {
+			return iterator{ dataVal + sizeVal };
+		}
+
+		const_iterator begin() const noexcept {
+			return const_iterator{ dataVal };
+		}
+
+		const_iterator end() const noexcept {
+			return const_iterator{ dataVal + sizeVal };
+		}
+
+		reverse_iterator rbegin() noexcept {
+			return reverse_iterator{ end() };
+		}
+
+		reverse_iterator rend() noexcept {
+			return reverse_iterator{ begin() };
+		}
+
+		const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator{ end() };
+		}
+
+		const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator{ begin() };
+		}
+
+		reference operator[](size_type index) noexcept {
+			return dataVal[index];
+		}
+
+		const_reference operator[](size_type index) const noexcept {
+			return dataVal[index];
+		}
+
+		reference front() noexcept {
+			return dataVal[0];
+		}
+
+		const_reference front() const noexcept {
+			return dataVal[0];
+		}
+
+		reference back() noexcept {
+			return dataVal[sizeVal - 1];
+		}
+
+		const_reference back() const noexcept {
+			return dataVal[sizeVal - 1];
+		}
+
+		pointer data() noexcept {
+			return dataVal;
+		}
+
+		const_pointer data() const noexcept {
+			return dataVal;
+		}
+
+		const_pointer c_str() const noexcept {
+			return dataVal;
+		}
+
+		size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		static constexpr size_type capacity() noexcept {
+			return fixedCapacity;
+		}
+
+		static constexpr size_type max_size() noexcept {
+			return fixedCapacity;
+		}
+
+		bool empty() const noexcept {
+			return sizeVal == 0;
+		}
+
+		void push_back(value_type value) {
+			checkCapacity(sizeVal + 1);
+			dataVal[sizeVal++] = value;
+			dataVal[sizeVal]   = value_type{};
+		}
+
+		void append(const_pointer other, size_type count) {
+			checkCapacity(sizeVal + count);
+			std::memmove(dataVal + sizeVal, other, count);
+			sizeVal += count;
+			dataVal[sizeVal] = value_type{};
+		}
+
+		void resize(size_type newSize) {
+			checkCapacity(newSize);
+			if (newSize > sizeVal) {
+				std::memset(dataVal + sizeVal, 0, newSize - sizeVal);
+			}
+			sizeVal			 = newSize;
+			dataVal[sizeVal] = value_type{};
+		}
+
+		/// @brief Resizes like resize, but leaves any characters past the old size unset, for callers that are about to overwrite them.
+		void resize_uninitialized(size_type newSize) {
+			checkCapacity(newSize);
+			sizeVal			 = newSize;
+			dataVal[sizeVal] = value_type{};
+		}
+
+		void clear() noexcept {
+			sizeVal	   = 0;
+			dataVal[0] = value_type{};
+		}
+
+		operator std::basic_string_view<value_type>() const noexcept {
+			return { dataVal, sizeVal };
+		}
+
+		template<size_t size> friend bool operator==(const static_string& lhs, const value_type (&rhs)[size]) noexcept {
+			const auto rhsLength = std::char_traits<value_type>::length(rhs);
+			return rhsLength == lhs.size() && internal::comparison::compare(lhs.data(), rhs, rhsLength);
+		}
+
+		template<concepts::string_t value_type_newer> friend bool operator==(const static_string& lhs, const value_type_newer& rhs) noexcept {
+			return lhs.size() == rhs.size() && (lhs.size() == 0 || internal::comparison::compare(lhs.data(), rhs.data(), rhs.size()));
+		}
+
+	  protected:
+		value_type dataVal[capacityNew + 1]{};
+		size_type sizeVal{};
+
+		static void checkCapacity(size_type sizeNew) {
+			if JSONIFIER_UNLIKELY (sizeNew > fixedCapacity) {
+				throw std::length_error{ "Sorry, but that is more characters than this static_string can hold." };
+			}
+		}
+	};
+
+}
@@ -0,0 +1,257 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Containers/Iterator.hpp>
+#include <jsonifier/Utilities/Compare.hpp>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace jsonifier {
+
+	/// @brief A vector whose elements live inline, in storage for fixedCapacity of them, so it never allocates. Growing it past fixedCapacity throws
+	/// std::length_error; parseJson instead keeps the first fixedCapacity elements, skips the rest and reports parse_errors::Capacity_Exceeded.
+	template<typename value_type_new, uint64_t capacityNew> class static_vector {
+	  public:
+		static_assert(capacityNew > 0, "Sorry, but a static_vector needs room for at least one element.");
+
+		using value_type			 = value_type_new;
+		using pointer				 = value_type*;
+		using const_pointer			 = const value_type*;
+		using reference				 = value_type&;
+		using const_reference		 = const value_type&;
+		using iterator				 = internal::basic_iterator<value_type>;
+		using const_iterator		 = internal::basic_iterator<const value_type>;
+		using difference_type		 = std::ptrdiff_t;
+		using reverse_iterator		 = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using size_type				 = size_t;
+
+		static constexpr size_type fixedCapacity{ capacityNew };
+
+		static_vector() noexcept = default;
+
+		static_vector(std::initializer_list<value_type> other) {
+			checkCapacity(other.size());
+			std::uninitialized_copy(other.begin(), other.end(), data());
+			sizeVal = other.size();
+		}
+
+		static_vector& operator=(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) {
+			if JSONIFIER_LIKELY (this != &other) {
+				clear();
+				std::uninitialized_move(other.data(), other.data() + other.sizeVal, data());
+				sizeVal = other.sizeVal;
+			}
+			return *this;
+		}
+
+		static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) {
+			*this = internal::move(other);
+		}
+
+		static_vector& operator=(const static_vector& other) {
+			if JSONIFIER_LIKELY (this != &other) {
+				clear();
+				std::uninitialized_copy(other.data(), other.data() + other.sizeVal, data());
+				sizeVal = other.sizeVal;
+			}
+			return *this;
+		}
+
+		static_vector(const static_vector& other) {
+			*this = other;
+		}
+
+		iterator begin() noexcept {
+			return iterator{ data() };
+		}
+
+		iterator end() noexcept {
+			return iterator{ data() + sizeVal };
+		}
+
+		const_iterator begin() const noexcept {
+			return const_iterator{ data() };
+		}
+
+		const_iterator end() const noexcept {
+			return const_iterator{ data() + sizeVal };
+		}
+
+		reverse_iterator rbegin() noexcept {
+			return reverse_iterator{ end() };
+		}
+
+		reverse_iterator rend() noexcept {
+			return reverse_iterator{ begin() };
+		}
+
+		const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator{ end() };
+		}
+
+		const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator{ begin() };
+		}
+
+		reference front() noexcept {
+			return data()[0];
+		}
+
+		const_reference front() const noexcept {
+			return data()[0];
+		}
+
+		reference back() noexcept {
+			return data()[sizeVal - 1];
+		}
+
+		const_reference back() const noexcept {
+			return data()[sizeVal - 1];
+		}
+
+		reference at(size_type index) {
+			if (index >= sizeVal) {
+				throw std::out_of_range{ "Sorry, but that index is beyond the end of this static_vector's bounds." };
+			}
+			return data()[index];
+		}
+
+		const_reference at(size_type index) const {
+			if (index >= sizeVal) {
+				throw std::out_of_range{ "Sorry, but that index is beyond the end of this static_vector's bounds." };
+			}
+			return data()[index];
+		}
+
+		reference operator[](size_type index) noexcept {
+			return data()[index];
+		}
+
+		const_reference operator[](size_type index) const noexcept {
+			return data()[index];
+		}
+
+		pointer data() noexcept {
+			return storage.values;
+		}
+
+		const_pointer data() const noexcept {
+			return storage.values;
+		}
+
+		size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		static constexpr size_type capacity() noexcept {
+			return fixedCapacity;
+		}
+
+		static constexpr size_type max_size() noexcept {
+			return fixedCapacity;
+		}
+
+		bool empty() const noexcept {
+			return sizeVal == 0;
+		}
+
+		template<typename... arg_types> reference emplace_back(arg_types&&... args) {
+			checkCapacity(sizeVal + 1);
+			std::construct_at(data() + sizeVal, std::forward<arg_types>(args)...);
+			return data()[sizeVal++];
+		}
+
+		void pop_back() noexcept {
+			std::destroy_at(data() + --sizeVal);
+		}
+
+		/// @brief Only checks newCapacity against fixedCapacity, since the storage is already in place.
+		void reserve(size_type newCapacity) {
+			checkCapacity(newCapacity);
+		}
+
+		void resize(size_type newSize) {
+			checkCapacity(newSize);
+			if (newSize > sizeVal) {
+				std::uninitialized_value_construct(data() + sizeVal, data() + newSize);
+			} else {
+				std::destroy(data() + newSize, data() + sizeVal);
+			}
+			sizeVal = newSize;
+		}
+
+		/// @brief Resizes like resize, but leaves any elements past the old size unset, for callers that are about to overwrite them.
+		void resize_uninitialized(size_type newSize) {
+			static_assert(std::is_trivially_default_constructible_v<value_type> && std::is_trivially_destructible_v<value_type>,
+				"Sorry, but resize_uninitialized is only available for trivially constructible and destructible element types.");
+			checkCapacity(newSize);
+			sizeVal = newSize;
+		}
+
+		void clear() noexcept {
+			std::destroy(data(), data() + sizeVal);
+			sizeVal = 0;
+		}
+
+		bool operator==(const static_vector& rhs) const {
+			if (rhs.size() != size()) {
+				return false;
+			}
+			for (size_type x = 0; x < sizeVal; ++x) {
+				if (!(rhs[x] == (*this)[x])) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		~static_vector() noexcept {
+			clear();
+		}
+
+	  protected:
+		/// @brief Leaves the elements unconstructed until they are added.
+		union storage_type {
+			storage_type() noexcept {
+			}
+
+			~storage_type() noexcept {
+			}
+
+			value_type values[capacityNew];
+		};
+
+		storage_type storage{};
+		size_type sizeVal{};
+
+		static void checkCapacity(size_type sizeNew) {
+			if JSONIFIER_UNLIKELY (sizeNew > fixedCapacity) {
+				throw std::length_error{ "Sorry, but that is more elements than this static_vector can hold." };
+			}
+		}
+	};
+
+}
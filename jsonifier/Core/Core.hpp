@@ -30,7 +30,7 @@
 namespace jsonifier::internal {
 
 	struct tuple_reference {
-		uint8_t oldIndex{};
+		uint16_t oldIndex{};
 		string_view key{};
 	};
 
@@ -42,23 +42,27 @@ namespace jsonifier::internal {
 	template<typename value_type>
 	concept has_name = requires(jsonifier::internal::remove_cvref_t<value_type> value) { value.name; };
 
-	template<size_t maxIndex, size_t currentIndex = 0, typename tuple_type>
-	static constexpr auto collectTupleRefsImpl(const tuple_type& tuple, array<tuple_reference, maxIndex>& tupleRefsRaw) {
-		if constexpr (currentIndex < maxIndex) {
-			auto potentialKey = internal::get<currentIndex>(tuple);
-			if constexpr (has_name<decltype(potentialKey)>) {
-				tupleRefsRaw[currentIndex].key = potentialKey.name.operator string_view();
-			}
-			tupleRefsRaw[currentIndex].oldIndex = currentIndex;
-			return collectTupleRefsImpl<maxIndex, currentIndex + 1>(tuple, tupleRefsRaw);
+	template<size_t currentIndex, typename tuple_type> static constexpr tuple_reference collectTupleRef(const tuple_type& tuple) {
+		tuple_reference returnValue{};
+		auto potentialKey = internal::get<currentIndex>(tuple);
+		if constexpr (has_name<decltype(potentialKey)>) {
+			returnValue.key = potentialKey.name.operator string_view();
 		}
+		returnValue.oldIndex = static_cast<uint16_t>(currentIndex);
+		return returnValue;
+	}
+
+	/// @brief Expanded as a fold rather than recursively, so that very wide types stay within the compiler's constexpr depth limit.
+	template<typename tuple_type, size_t... indices> static constexpr auto collectTupleRefsImpl(const tuple_type& tuple, index_sequence<indices...>) {
+		array<tuple_reference, sizeof...(indices)> tupleRefsRaw{};
+		((tupleRefsRaw[indices] = collectTupleRef<indices>(tuple)), ...);
 		return tupleRefsRaw;
 	}
 
 	template<typename tuple_type> static constexpr auto collectTupleRefs(const tuple_type& tuple) {
 		constexpr auto tupleSize = tuple_size_v<tuple_type>;
-		array<tuple_reference, tupleSize> tupleRefsRaw{};
-		return collectTupleRefsImpl<tupleSize>(tuple, tupleRefsRaw);
+		static_assert(tupleSize <= std::numeric_limits<uint16_t>::max(), "Sorry, but jsonifier supports at most 65535 members per type.");
+		return collectTupleRefsImpl(tuple, make_index_sequence<tupleSize>{});
 	}
 
 	template<size_t size> static constexpr auto sortTupleRefsByFirstByte(const array<tuple_reference, size>& tupleRefsRaw) {
@@ -27,62 +27,256 @@
 #include <jsonifier/Serializing/Serializer.hpp>
 #include <jsonifier/Serializing/Prettifier.hpp>
 #include <jsonifier/Parsing/Parser.hpp>
+#include <jsonifier/Utilities/MappedFile.hpp>
+#include <jsonifier/Core/Scratch.hpp>
 #include <jsonifier/Utilities/Error.hpp>
 
 namespace jsonifier {
 
-	template<bool doWeUseInitialBuffer = true> class jsonifier_core : public internal::prettifier<jsonifier_core<doWeUseInitialBuffer>>,
-																	  public internal::serializer<jsonifier_core<doWeUseInitialBuffer>>,
-																	  public internal::validator<jsonifier_core<doWeUseInitialBuffer>>,
-																	  public internal::minifier<jsonifier_core<doWeUseInitialBuffer>>,
-																	  public internal::parser<jsonifier_core<doWeUseInitialBuffer>> {
+	template<bool doWeUseInitialBuffer = true, typename allocator_type = aligned_allocator> class jsonifier_core : public internal::prettifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>,
+																	  public internal::serializer<jsonifier_core<doWeUseInitialBuffer, allocator_type>>,
+																	  public internal::validator<jsonifier_core<doWeUseInitialBuffer, allocator_type>>,
+																	  public internal::minifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>,
+																	  public internal::parser<jsonifier_core<doWeUseInitialBuffer, allocator_type>> {
 	  public:
-		friend class internal::prettifier<jsonifier_core<doWeUseInitialBuffer>>;
-		friend class internal::serializer<jsonifier_core<doWeUseInitialBuffer>>;
-		friend class internal::validator<jsonifier_core<doWeUseInitialBuffer>>;
-		friend class internal::minifier<jsonifier_core<doWeUseInitialBuffer>>;
-		friend class internal::parser<jsonifier_core<doWeUseInitialBuffer>>;
+		friend class internal::prettifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		friend class internal::serializer<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		friend class internal::validator<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		friend class internal::minifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		friend class internal::parser<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
 
-		jsonifier_core() noexcept = default;
+		using scratch_type = scratch<doWeUseInitialBuffer, allocator_type>;
 
+		static constexpr scratch_options defaultScratchOptions{ scratch_type::defaultScratchOptions };
+
+		jsonifier_core() noexcept : jsonifier_core{ defaultScratchOptions } {
+		}
+
+		explicit jsonifier_core(const scratch_options& scratchOptionsNew, const allocator_type& allocatorNew = allocator_type{}) noexcept
+			: ownScratch{ scratchOptionsNew, allocatorNew } {
+		}
+
+		/// @brief Runs every call on scratchNew instead of a scratch of its own, which it never allocates. Such a core is cheap to make on the
+		/// stack for a single call; scratchNew must outlive it and must not be used by another call at the same time.
+		explicit jsonifier_core(scratch_type& scratchNew) noexcept : scratchPtr{ &scratchNew } {
+		}
+
+		/// @brief A core that owns its scratch takes over other's; a core bound to an outside scratch stays bound to that same scratch.
 		jsonifier_core& operator=(jsonifier_core&& other) noexcept {
 			if JSONIFIER_LIKELY (this != &other) {
-				errors = internal::move(other.errors);
+				if (other.ownsScratch()) {
+					ownScratch = internal::move(other.ownScratch);
+					scratchPtr = &ownScratch;
+				} else {
+					scratchPtr = other.scratchPtr;
+				}
 			}
 			return *this;
 		}
 
-		jsonifier_core(jsonifier_core&& other) noexcept : prettifier{}, serializer{}, validator{}, minifier{}, parser{} {
-			*this = internal::move(other);
-		};
+		jsonifier_core(jsonifier_core&& other) noexcept
+			: prettifier{}, serializer{}, validator{}, minifier{}, parser{}, ownScratch{ internal::move(other.ownScratch) },
+			  scratchPtr{ other.ownsScratch() ? &ownScratch : other.scratchPtr } {
+		}
 
 		jsonifier_core& operator=(const jsonifier_core& other) noexcept {
 			if JSONIFIER_LIKELY (this != &other) {
-				errors = other.errors;
+				if (other.ownsScratch()) {
+					ownScratch = other.ownScratch;
+					scratchPtr = &ownScratch;
+				} else {
+					scratchPtr = other.scratchPtr;
+				}
 			}
 			return *this;
 		}
 
-		jsonifier_core(const jsonifier_core& other) noexcept : prettifier{}, serializer{}, validator{}, minifier{}, parser{} {
-			*this = other;
+		jsonifier_core(const jsonifier_core& other) noexcept
+			: prettifier{}, serializer{}, validator{}, minifier{}, parser{}, ownScratch{ other.ownScratch },
+			  scratchPtr{ other.ownsScratch() ? &ownScratch : other.scratchPtr } {
+		}
+
+		JSONIFIER_INLINE scratch_type& getScratch() noexcept {
+			return *scratchPtr;
+		}
+
+		JSONIFIER_INLINE const scratch_type& getScratch() const noexcept {
+			return *scratchPtr;
 		}
 
 		const std::vector<internal::error>& getErrors() const noexcept {
-			return errors;
+			return scratchPtr->getErrors();
+		}
+
+		const scratch_options& getScratchOptions() const noexcept {
+			return scratchPtr->getScratchOptions();
+		}
+
+		/// @brief Takes effect from the next allocation on; buffers already held are kept until shrinkTo or the high-water mark releases them.
+		void setScratchOptions(const scratch_options& scratchOptionsNew) noexcept {
+			scratchPtr->setScratchOptions(scratchOptionsNew);
+		}
+
+		/// @brief Bytes currently held by the string buffer, the structural tape and the bracket table.
+		uint64_t getScratchUsage() const noexcept {
+			return scratchPtr->getScratchUsage();
+		}
+
+		/// @brief Releases scratch buffers, the larger first, until at most bytes remain held.
+		void shrinkTo(uint64_t bytes) noexcept {
+			scratchPtr->shrinkTo(bytes);
+		}
+
+		/// @brief Releases every scratch buffer.
+		void trim() noexcept {
+			scratchPtr->trim();
+		}
+
+		/// @brief Parses the file at path straight from a mapped_file, without reading it into a string first. Values that view their input, such as
+		/// json_number, must not outlive the call; to keep them, hold a mapped_file and parse its view() instead.
+		template<parse_options options = parse_options{}, typename value_type> bool parseJsonFile(value_type&& object, string_view path) noexcept {
+			const mapped_file file{ path };
+			if JSONIFIER_UNLIKELY (!file) {
+				reportFileError<internal::error_classes::Parsing, internal::parse_errors::File_Read_Failure>();
+				return false;
+			}
+			return parser::template parseJson<options>(object, file.view());
+		}
+
+		bool validateJsonFile(string_view path) noexcept {
+			const mapped_file file{ path };
+			if JSONIFIER_UNLIKELY (!file) {
+				reportFileError<internal::error_classes::Validating, internal::validate_errors::File_Read_Failure>();
+				return false;
+			}
+			return validator::validateJson(file.view());
+		}
+
+		template<concepts::string_t string_type> bool minifyJsonFile(string_view path, string_type&& buffer) noexcept {
+			const mapped_file file{ path };
+			if JSONIFIER_UNLIKELY (!file) {
+				reportFileError<internal::error_classes::Minifying, internal::minify_errors::File_Read_Failure>();
+				return false;
+			}
+			const string_view in{ file.data(), file.size() };
+			return minifier::minifyJson(in, buffer);
 		}
 
 		~jsonifier_core() noexcept = default;
 
 	  protected:
-		using prettifier = internal::prettifier<jsonifier_core<doWeUseInitialBuffer>>;
-		using serializer = internal::serializer<jsonifier_core<doWeUseInitialBuffer>>;
-		using validator	 = internal::validator<jsonifier_core<doWeUseInitialBuffer>>;
-		using minifier	 = internal::minifier<jsonifier_core<doWeUseInitialBuffer>>;
-		using parser	 = internal::parser<jsonifier_core<doWeUseInitialBuffer>>;
-
-		string_base<char, 1024 * 1024> stringBuffer{};
-		internal::simd_string_reader<true> section{};
-		std::vector<internal::error> errors{};
+		using prettifier = internal::prettifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		using serializer = internal::serializer<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		using validator	 = internal::validator<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		using minifier	 = internal::minifier<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+		using parser	 = internal::parser<jsonifier_core<doWeUseInitialBuffer, allocator_type>>;
+
+		bool ownsScratch() const noexcept {
+			return scratchPtr == &ownScratch;
+		}
+
+		template<internal::error_classes errorClass, auto errorType> void reportFileError() noexcept {
+			scratchPtr->errors.clear();
+			scratchPtr->errors.emplace_back(internal::error::constructError<errorClass, errorType>(0, 0, nullptr));
+		}
+
+		scratch_type ownScratch{};
+		scratch_type* scratchPtr{ &ownScratch };
+	};
+
+	/// @brief Stateless front end to jsonifier_core that any number of threads may share. Each call runs on the scratch it is given, or on one
+	/// leased from scratch_pool for the length of the call, so no state is tied to a thread or carried from one call to the next. The errors of a
+	/// call are kept on its scratch; pass one to read them back with getErrors. A pooled call whose scratch cannot be allocated returns false.
+	template<bool doWeUseInitialBuffer = true, typename allocator_type = aligned_allocator> class shared_core {
+	  public:
+		using scratch_type = scratch<doWeUseInitialBuffer, allocator_type>;
+		using core_type	   = jsonifier_core<doWeUseInitialBuffer, allocator_type>;
+		using pool_type	   = scratch_pool<doWeUseInitialBuffer, allocator_type>;
+
+		shared_core() noexcept = default;
+
+		/// @brief Leases the scratches of calls that are given none from poolNew rather than the process-wide pool; poolNew must outlive this shared_core.
+		explicit shared_core(pool_type& poolNew) noexcept : poolPtr{ &poolNew } {
+		}
+
+		/// @brief A core that runs on scratchNew, for the calls shared_core does not forward itself.
+		core_type bind(scratch_type& scratchNew) const noexcept {
+			return core_type{ scratchNew };
+		}
+
+		template<parse_options options = parse_options{}, typename value_type, typename buffer_type>
+		bool parseJson(scratch_type& scratchNew, value_type&& object, buffer_type&& in) const noexcept {
+			core_type core{ scratchNew };
+			return core.template parseJson<options>(object, in);
+		}
+
+		template<parse_options options = parse_options{}, typename value_type, typename buffer_type> bool parseJson(value_type&& object, buffer_type&& in) const noexcept {
+			const auto lease{ poolPtr->acquire() };
+			if JSONIFIER_UNLIKELY (!lease) {
+				return false;
+			}
+			return parseJson<options>(*lease, object, in);
+		}
+
+		template<typename string_type> bool validateJson(scratch_type& scratchNew, string_type&& in) const noexcept {
+			core_type core{ scratchNew };
+			return core.validateJson(in);
+		}
+
+		template<typename string_type> bool validateJson(string_type&& in) const noexcept {
+			const auto lease{ poolPtr->acquire() };
+			if JSONIFIER_UNLIKELY (!lease) {
+				return false;
+			}
+			return validateJson(*lease, in);
+		}
+
+		template<serialize_options options = serialize_options{}, typename value_type, concepts::buffer_like buffer_type>
+		bool serializeJson(scratch_type& scratchNew, value_type&& object, buffer_type&& buffer) const noexcept {
+			core_type core{ scratchNew };
+			return core.template serializeJson<options>(object, buffer);
+		}
+
+		template<serialize_options options = serialize_options{}, typename value_type, concepts::buffer_like buffer_type>
+		bool serializeJson(value_type&& object, buffer_type&& buffer) const noexcept {
+			const auto lease{ poolPtr->acquire() };
+			if JSONIFIER_UNLIKELY (!lease) {
+				return false;
+			}
+			return serializeJson<options>(*lease, object, buffer);
+		}
+
+		template<concepts::string_t string_type01, concepts::string_t string_type02>
+		bool minifyJson(scratch_type& scratchNew, string_type01&& in, string_type02&& buffer) const noexcept {
+			core_type core{ scratchNew };
+			return core.minifyJson(in, buffer);
+		}
+
+		template<concepts::string_t string_type01, concepts::string_t string_type02> bool minifyJson(string_type01&& in, string_type02&& buffer) const noexcept {
+			const auto lease{ poolPtr->acquire() };
+			if JSONIFIER_UNLIKELY (!lease) {
+				return false;
+			}
+			return minifyJson(*lease, in, buffer);
+		}
+
+		template<prettify_options options = prettify_options{}, concepts::string_t string_type01, concepts::string_t string_type02>
+		bool prettifyJson(scratch_type& scratchNew, string_type01&& in, string_type02&& buffer) const noexcept {
+			core_type core{ scratchNew };
+			return core.template prettifyJson<options>(in, buffer);
+		}
+
+		template<prettify_options options = prettify_options{}, concepts::string_t string_type01, concepts::string_t string_type02>
+		bool prettifyJson(string_type01&& in, string_type02&& buffer) const noexcept {
+			const auto lease{ poolPtr->acquire() };
+			if JSONIFIER_UNLIKELY (!lease) {
+				return false;
+			}
+			return prettifyJson<options>(*lease, in, buffer);
+		}
+
+	  protected:
+		pool_type* poolPtr{ &pool_type::getInstance() };
 	};
 
 }
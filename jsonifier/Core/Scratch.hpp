@@ -0,0 +1,318 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/StringUtils.hpp>
+#include <jsonifier/Utilities/String.hpp>
+#include <jsonifier/Utilities/Error.hpp>
+#include <jsonifier/Utilities/Simd.hpp>
+#include <atomic>
+#include <new>
+
+namespace jsonifier {
+
+	template<bool doWeUseInitialBuffer, typename allocator_type> class jsonifier_core;
+
+	namespace internal {
+
+		template<typename derived_type> class prettifier;
+		template<typename derived_type> class serializer;
+		template<typename derived_type> class validator;
+		template<typename derived_type> class minifier;
+		template<typename derived_type> class parser;
+
+	}
+
+	/// @brief The mutable state behind a jsonifier_core call: the string buffer, the structural tape and the errors of the last call.
+	/// A scratch is used by one call at a time, but it is not tied to a thread, so a task may carry its scratch from one thread to the next.
+	template<bool doWeUseInitialBuffer = true, typename allocator_type = aligned_allocator> class scratch {
+	  public:
+		template<typename derived_type> friend class internal::prettifier;
+		template<typename derived_type> friend class internal::serializer;
+		template<typename derived_type> friend class internal::validator;
+		template<typename derived_type> friend class internal::minifier;
+		template<typename derived_type> friend class internal::parser;
+		template<typename scratch_type> friend struct internal::scratch_limit_guard;
+		friend class jsonifier_core<doWeUseInitialBuffer, allocator_type>;
+
+		/// @brief The scratch sizes a scratch starts with: a 1 MiB string buffer and a 4M-entry tape with doWeUseInitialBuffer, and only what each
+		/// call needs without it. Either way nothing is allocated until a call first uses it.
+		static constexpr scratch_options defaultScratchOptions{ doWeUseInitialBuffer ? 1024 * 1024 : 0, doWeUseInitialBuffer ? 1024 * 1024 * 4 : 0 };
+
+		using string_type = string_base<char, 0, allocator_type>;
+
+		/// @brief Errors a fixedCapacity scratch has room for; later ones in the same call are dropped.
+		static constexpr uint64_t fixedErrorCapacity{ 16 };
+
+		scratch() noexcept : scratch{ defaultScratchOptions } {
+		}
+
+		/// @brief The string buffer and the tape are both drawn from allocatorNew.
+		explicit scratch(const scratch_options& scratchOptionsNew, const allocator_type& allocatorNew = allocator_type{}) noexcept
+			: stringBuffer{ allocatorNew }, section{ allocatorNew } {
+			setScratchOptions(scratchOptionsNew);
+		}
+
+		scratch& operator=(scratch&& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				errors = internal::move(other.errors);
+				setScratchOptions(other.scratchOptions);
+			}
+			return *this;
+		}
+
+		scratch(scratch&& other) noexcept : stringBuffer{ other.getAllocator() }, section{ other.getAllocator() } {
+			*this = internal::move(other);
+		}
+
+		scratch& operator=(const scratch& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				errors = other.errors;
+				setScratchOptions(other.scratchOptions);
+			}
+			return *this;
+		}
+
+		scratch(const scratch& other) noexcept : stringBuffer{ other.getAllocator() }, section{ other.getAllocator() } {
+			*this = other;
+		}
+
+		const std::vector<internal::error>& getErrors() const noexcept {
+			return errors;
+		}
+
+		const allocator_type& getAllocator() const noexcept {
+			return stringBuffer.getAllocator();
+		}
+
+		const scratch_options& getScratchOptions() const noexcept {
+			return scratchOptions;
+		}
+
+		/// @brief Takes effect from the next allocation on; buffers already held are kept until shrinkTo or the high-water mark releases them. With
+		/// fixedCapacity the buffers are allocated here instead, so a scratch drawing from a resource_allocator over a caller's static buffer (with
+		/// std::pmr::null_memory_resource() upstream) keeps every parse inside that buffer.
+		void setScratchOptions(const scratch_options& scratchOptionsNew) noexcept {
+			scratchOptions = scratchOptionsNew;
+			section.setInitialTapeSize(scratchOptions.initialTapeSize);
+			section.setFixedTape(scratchOptions.fixedCapacity);
+			if (scratchOptions.fixedCapacity) {
+				reserveStringBuffer(0);
+				errors.reserve(fixedErrorCapacity);
+			}
+		}
+
+		/// @brief Bytes currently held by the string buffer, the structural tape and the bracket table.
+		uint64_t getScratchUsage() const noexcept {
+			return stringBuffer.capacity() + section.getScratchBytes();
+		}
+
+		/// @brief Releases scratch buffers, the larger first, until at most bytes remain held. Released buffers are allocated again, at their initial
+		/// sizes, by the next call that needs them. A string_view returned by serializeJson(object) points into the string buffer and does not outlive it.
+		/// A fixedCapacity scratch keeps its buffers.
+		void shrinkTo(uint64_t bytes) noexcept {
+			if (scratchOptions.fixedCapacity) {
+				return;
+			}
+			const uint64_t stringBytes{ stringBuffer.capacity() };
+			const uint64_t tapeBytes{ section.getScratchBytes() };
+			if (stringBytes + tapeBytes <= bytes) {
+				return;
+			}
+			if (tapeBytes >= stringBytes) {
+				section.release();
+				if (stringBytes > bytes) {
+					stringBuffer.swap(string_type{ stringBuffer.getAllocator() });
+				}
+			} else {
+				stringBuffer.swap(string_type{ stringBuffer.getAllocator() });
+				if (tapeBytes > bytes) {
+					section.release();
+				}
+			}
+		}
+
+		/// @brief Releases every scratch buffer.
+		void trim() noexcept {
+			shrinkTo(0);
+		}
+
+	  protected:
+		/// @brief Grows the string buffer to at least sizeNew bytes, and to its initial size the first time it is used. A buffer the allocator cannot
+		/// grow is left as it stands, or at its initial size if it had not reached it; the parsing and prettifying calls compare its size against what
+		/// they need and report Capacity_Exceeded.
+		JSONIFIER_INLINE void reserveStringBuffer(uint64_t sizeNew) noexcept {
+			sizeNew = sizeNew > scratchOptions.initialStringBufferSize ? sizeNew : scratchOptions.initialStringBufferSize;
+			if (stringBuffer.size() < sizeNew) {
+				try {
+					stringBuffer.resize_uninitialized(sizeNew);
+				} catch (const std::bad_alloc&) {
+					if (stringBuffer.size() < scratchOptions.initialStringBufferSize && sizeNew > scratchOptions.initialStringBufferSize) {
+						reserveStringBuffer(0);
+					}
+				}
+			}
+		}
+
+		/// @brief Grows the string buffer as reserveStringBuffer does for the parsing calls, which bound each string by the buffer's size and so can
+		/// work within a fixedCapacity scratch's buffer as it was allocated.
+		JSONIFIER_INLINE void reserveParseBuffer(uint64_t sizeNew) noexcept {
+			if JSONIFIER_LIKELY (!scratchOptions.fixedCapacity) {
+				reserveStringBuffer(sizeNew);
+			}
+		}
+
+		/// @brief Records an error unless a fixedCapacity scratch has no room left for it.
+		JSONIFIER_INLINE void recordError(internal::error&& errorNew) noexcept {
+			if JSONIFIER_LIKELY (!scratchOptions.fixedCapacity || errors.size() < errors.capacity()) {
+				errors.emplace_back(internal::move(errorNew));
+			}
+		}
+
+		string_type stringBuffer{};
+		internal::simd_string_reader<doWeUseInitialBuffer, allocator_type> section{};
+		std::vector<internal::error> errors{};
+		scratch_options scratchOptions{};
+		uint64_t scratchCallDepth{};
+	};
+
+	template<bool doWeUseInitialBuffer, typename allocator_type> class scratch_pool;
+
+	/// @brief Owns a scratch taken from a scratch_pool and hands it back to that pool when destroyed. It is empty, and converts to false, when the pool
+	/// could not allocate a scratch.
+	template<bool doWeUseInitialBuffer = true, typename allocator_type = aligned_allocator> class scratch_lease {
+	  public:
+		using scratch_type = scratch<doWeUseInitialBuffer, allocator_type>;
+		using pool_type	   = scratch_pool<doWeUseInitialBuffer, allocator_type>;
+
+		scratch_lease& operator=(const scratch_lease&) = delete;
+		scratch_lease(const scratch_lease&)			   = delete;
+
+		scratch_lease& operator=(scratch_lease&& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				release();
+				poolPtr			 = other.poolPtr;
+				scratchPtr		 = other.scratchPtr;
+				other.scratchPtr = nullptr;
+			}
+			return *this;
+		}
+
+		scratch_lease(scratch_lease&& other) noexcept {
+			*this = internal::move(other);
+		}
+
+		scratch_type& operator*() const noexcept {
+			return *scratchPtr;
+		}
+
+		scratch_type* operator->() const noexcept {
+			return scratchPtr;
+		}
+
+		explicit operator bool() const noexcept {
+			return scratchPtr != nullptr;
+		}
+
+		~scratch_lease() noexcept {
+			release();
+		}
+
+	  protected:
+		friend class scratch_pool<doWeUseInitialBuffer, allocator_type>;
+
+		pool_type* poolPtr{};
+		scratch_type* scratchPtr{};
+
+		scratch_lease(pool_type* poolPtrNew, scratch_type* scratchPtrNew) noexcept : poolPtr{ poolPtrNew }, scratchPtr{ scratchPtrNew } {
+		}
+
+		void release() noexcept;
+	};
+
+	/// @brief Lock-free cache of scratch contexts, for callers that do not keep one of their own. getInstance is the process-wide pool, whose
+	/// scratches draw from a default-constructed allocator_type; construct a pool with an allocator, e.g. a resource_allocator, to have its
+	/// scratches draw from that instead. Such a pool must outlive every lease taken from it.
+	/// Idle scratches sit in a fixed set of slots. acquire takes one with an atomic exchange on the first slot whose relaxed load is non-null, and
+	/// release parks one with a compare-exchange on the first slot whose relaxed load is null; when every slot is empty a new scratch is made, and
+	/// when every slot is full a returned scratch is freed, so the pool holds at most slotCount idle scratches.
+	/// A pooled scratch is never shrunk: once parked, it keeps the largest tape and buffers any parse or serialize grew it to for the life of the
+	/// process, so one huge document pins that much memory in its slot. Callers that need to bound this should own a scratch instead.
+	template<bool doWeUseInitialBuffer = true, typename allocator_type = aligned_allocator> class scratch_pool {
+	  public:
+		using scratch_type = scratch<doWeUseInitialBuffer, allocator_type>;
+		static constexpr uint64_t slotCount{ 64 };
+
+		scratch_pool& operator=(const scratch_pool&) = delete;
+		scratch_pool(const scratch_pool&)			 = delete;
+
+		explicit scratch_pool(const allocator_type& allocatorNew = allocator_type{}) noexcept : allocator{ allocatorNew } {
+		}
+
+		static scratch_pool& getInstance() noexcept {
+			static scratch_pool pool{};
+			return pool;
+		}
+
+		/// @brief An idle scratch, or a new one when there is none; the lease is empty if that allocation fails.
+		scratch_lease<doWeUseInitialBuffer, allocator_type> acquire() noexcept {
+			for (auto& slot: slots) {
+				if (slot.load(std::memory_order_relaxed)) {
+					if (scratch_type* scratchPtr{ slot.exchange(nullptr, std::memory_order_acquire) }; scratchPtr) {
+						return scratch_lease<doWeUseInitialBuffer, allocator_type>{ this, scratchPtr };
+					}
+				}
+			}
+			return scratch_lease<doWeUseInitialBuffer, allocator_type>{ this, new (std::nothrow) scratch_type{ scratch_type::defaultScratchOptions, allocator } };
+		}
+
+		void release(scratch_type* scratchPtr) noexcept {
+			for (auto& slot: slots) {
+				scratch_type* expected{};
+				if (!slot.load(std::memory_order_relaxed) && slot.compare_exchange_strong(expected, scratchPtr, std::memory_order_release, std::memory_order_relaxed)) {
+					return;
+				}
+			}
+			delete scratchPtr;
+		}
+
+		~scratch_pool() noexcept {
+			for (auto& slot: slots) {
+				delete slot.exchange(nullptr, std::memory_order_acquire);
+			}
+		}
+
+	  protected:
+		std::atomic<scratch_type*> slots[slotCount]{};
+		allocator_type allocator{};
+	};
+
+	template<bool doWeUseInitialBuffer, typename allocator_type> void scratch_lease<doWeUseInitialBuffer, allocator_type>::release() noexcept {
+		if (scratchPtr) {
+			poolPtr->release(scratchPtr);
+			scratchPtr = nullptr;
+		}
+	}
+
+}
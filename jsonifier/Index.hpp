@@ -31,10 +31,17 @@
 #include <jsonifier/Serializing/Serialize_Impl.hpp>
 #include <jsonifier/Core/JsonifierCore.hpp>
 #include <jsonifier/Utilities/RawJsonData.hpp>
+#include <jsonifier/Utilities/Decimal.hpp>
+#include <jsonifier/Utilities/TimePoint.hpp>
 #include <jsonifier/Serializing/Prettifier.hpp>
 #include <jsonifier/Serializing/Serializer.hpp>
 #include <jsonifier/Serializing/Minifier.hpp>
 #include <jsonifier/Utilities/HashMap.hpp>
+#include <jsonifier/Utilities/FlatMap.hpp>
 #include <jsonifier/Parsing/Parser.hpp>
 #include <jsonifier/Utilities/String.hpp>
+#include <jsonifier/Utilities/PaddedString.hpp>
+#include <jsonifier/Containers/HugePageAllocator.hpp>
+#include <jsonifier/Containers/StaticVector.hpp>
+#include <jsonifier/Containers/StaticString.hpp>
 #include <jsonifier/Utilities/Simd.hpp>
@@ -25,6 +25,8 @@
 
 #include <jsonifier/Utilities/NumberUtils.hpp>
 #include <jsonifier/Utilities/StringUtils.hpp>
+#include <jsonifier/Utilities/Decimal.hpp>
+#include <jsonifier/Utilities/TimePoint.hpp>
 #include <jsonifier/Parsing/Parser.hpp>
 
 #include <memory>
@@ -40,13 +42,13 @@ namespace jsonifier::internal {
 			static constexpr auto ptrNew						= tupleElem.memberPtr;
 			static constexpr auto keySize						= stringLiteral.size();
 			static constexpr auto keySizeNew					= keySize + 1;
-			if JSONIFIER_LIKELY (((context.iter + keySize) < context.endIter) && (*(context.iter + keySize)) == quote &&
+			if JSONIFIER_LIKELY (canRead<options, keySize>(context.iter, context.endIter) && (*(context.iter + keySize)) == quote &&
 				string_literal_comparitor<decltype(stringLiteral), stringLiteral>::impl(context.iter)) {
 				context.iter += keySizeNew;
 				if constexpr (!minifiedOrInsideRepeated) {
 					JSONIFIER_SKIP_WS();
 				}
-				if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+				if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 					++context.iter;
 					if constexpr (!minifiedOrInsideRepeated) {
 						JSONIFIER_SKIP_WS();
@@ -186,11 +188,11 @@ namespace jsonifier::internal {
 				static constexpr auto ptrNew						= json_entity_type::memberPtr;
 				static constexpr auto keySize						= stringLiteral.size();
 				static constexpr auto keySizeNew					= keySize + 1;
-				if JSONIFIER_LIKELY (((context.iter + keySize) < context.endIter) && (*(context.iter + keySize)) == quote &&
+				if JSONIFIER_LIKELY (canRead<options, keySize>(context.iter, context.endIter) && (*(context.iter + keySize)) == quote &&
 					string_literal_comparitor<decltype(stringLiteral), stringLiteral>::impl(context.iter)) {
 					context.iter += keySizeNew;
 					JSONIFIER_SKIP_WS();
-					if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+					if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 						++context.iter;
 						JSONIFIER_SKIP_WS();
 						if constexpr (concepts::has_excluded_keys<value_type>) {
@@ -246,7 +248,7 @@ namespace jsonifier::internal {
 			base::template skipKeyStarted<value_type>(context);
 			++context.iter;
 			JSONIFIER_SKIP_WS();
-			if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == ':') {
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == ':') {
 				++context.iter;
 				JSONIFIER_SKIP_WS();
 				base::skipToNextValue(context);
@@ -267,7 +269,7 @@ namespace jsonifier::internal {
 						if constexpr (haveWeStarted || json_entity_type::index > 0) {
 							check_for_entry_comma<options>::impl(context, wsStart, wsSize);
 						}
-						if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == quote) {
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == quote) {
 							++context.iter;
 							processIndexImpl(value, context, wsStart, wsSize);
 						}
@@ -276,7 +278,7 @@ namespace jsonifier::internal {
 							base::template skipKeyStarted<value_type>(context);
 							++context.iter;
 							JSONIFIER_SKIP_WS();
-							if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == ':') {
+							if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == ':') {
 								++context.iter;
 								JSONIFIER_SKIP_WS();
 							} else [[unlikely]] {
@@ -317,10 +319,10 @@ namespace jsonifier::internal {
 				static constexpr auto ptrNew						= json_entity_type::memberPtr;
 				static constexpr auto keySize						= stringLiteral.size();
 				static constexpr auto keySizeNew					= keySize + 1;
-				if JSONIFIER_LIKELY (((context.iter + keySize) < context.endIter) && (*(context.iter + keySize)) == quote &&
+				if JSONIFIER_LIKELY (canRead<options, keySize>(context.iter, context.endIter) && (*(context.iter + keySize)) == quote &&
 					string_literal_comparitor<decltype(stringLiteral), stringLiteral>::impl(context.iter)) {
 					context.iter += keySizeNew;
-					if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+					if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 						++context.iter;
 						if constexpr (concepts::has_excluded_keys<value_type>) {
 							static constexpr auto key = stringLiteral.operator string_view();
@@ -374,7 +376,7 @@ namespace jsonifier::internal {
 			}
 			base::template skipKeyStarted<value_type>(context);
 			++context.iter;
-			if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == ':') {
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == ':') {
 				++context.iter;
 				base::skipToNextValue(context);
 				return processIndex<value_type, context_type, true>(value, context);
@@ -393,7 +395,7 @@ namespace jsonifier::internal {
 						if constexpr (haveWeStarted || json_entity_type::index > 0) {
 							check_for_entry_comma<options>::impl(context);
 						}
-						if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == quote) {
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == quote) {
 							++context.iter;
 							processIndexImpl(value, context);
 						}
@@ -401,7 +403,7 @@ namespace jsonifier::internal {
 							context.parserPtr->template reportError<parse_errors::Missing_String_Start>(context);
 							base::template skipKeyStarted<value_type>(context);
 							++context.iter;
-							if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == ':') {
+							if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == ':') {
 								++context.iter;
 							} else [[unlikely]] {
 								context.parserPtr->template reportError<parse_errors::Missing_Colon>(context);
@@ -651,17 +653,20 @@ namespace jsonifier::internal {
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
 			static thread_local typename value_type::key_type key{};
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBrace) {
 					++context.iter;
 					++context.currentObjectDepth;
 					if JSONIFIER_LIKELY (*context.iter != rBrace) {
+						if constexpr (options.reserveContainers && concepts::has_reserve<value_type>) {
+							value.reserve(value.size() + countDirectChildren(context.iter, context.endIter));
+						}
 						const auto wsStart = context.iter;
 						JSONIFIER_SKIP_WS();
 						size_t wsSize{ static_cast<size_t>(context.iter - wsStart) };
 						parse<options, false>::impl(key, context);
 
-						if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 							++context.iter;
 							JSONIFIER_SKIP_WS();
 							parse<options, false>::impl(value[key], context);
@@ -704,7 +709,7 @@ namespace jsonifier::internal {
 						JSONIFIER_SKIP_MATCHING_WS();
 						parse<options, false>::impl(key, context);
 
-						if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 							++context.iter;
 							JSONIFIER_SKIP_WS();
 							parse<options, false>::impl(value[key], context);
@@ -730,14 +735,17 @@ namespace jsonifier::internal {
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
 			static thread_local typename value_type::key_type key{};
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBrace) {
 					++context.iter;
 					++context.currentObjectDepth;
 					if JSONIFIER_LIKELY (*context.iter != rBrace) {
+						if constexpr (options.reserveContainers && concepts::has_reserve<value_type>) {
+							value.reserve(value.size() + countDirectChildren(context.iter, context.endIter));
+						}
 						parse<options, true>::impl(key, context);
 
-						if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 							++context.iter;
 							parse<options, true>::impl(value[key], context);
 						}
@@ -752,7 +760,7 @@ namespace jsonifier::internal {
 								++context.iter;
 								parse<options, true>::impl(key, context);
 
-								if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == colon) {
+								if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
 									++context.iter;
 									parse<options, true>::impl(value[key], context);
 								} else {
@@ -805,12 +813,80 @@ namespace jsonifier::internal {
 
 	JSONIFIER_INLINE void noop() noexcept {};
 
+	/// @brief Bulk kernel for arrays of numbers: sizes the vector once from a simd comma count and then parses straight into its storage.
+	template<typename value_type, typename context_type, parse_options options, bool minified> struct parse_numeric_array {
+		using base		   = derailleur<options, context_type>;
+		using element_type = typename value_type::value_type;
+
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			size_t size{ 1 + char_counter<comma, rBracket, char>::countUntil(context.iter, static_cast<uint64_t>(context.endIter - context.iter)) };
+			if constexpr (concepts::fixed_capacity_t<value_type>) {
+				size = size < value_type::fixedCapacity ? size : value_type::fixedCapacity;
+			}
+			resizeUninitialized(value, size);
+			auto newIter = getBeginIterVec(value);
+			size_t index{};
+			while (true) {
+				if JSONIFIER_UNLIKELY (index == size) {
+					if constexpr (concepts::fixed_capacity_t<value_type>) {
+						if (size == value_type::fixedCapacity) {
+							base::rejectExcessValues(context);
+							return;
+						}
+						size = size * 2 < value_type::fixedCapacity ? size * 2 : value_type::fixedCapacity;
+					} else {
+						size *= 2;
+					}
+					resizeUninitialized(value, size);
+					newIter = getBeginIterVec(value);
+				}
+				if JSONIFIER_UNLIKELY (context.iter >= context.endIter || !parseElement(newIter[static_cast<int64_t>(index)], context)) {
+					value.resize(index);
+					context.parserPtr->template reportError<parse_errors::Invalid_Number_Value>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				++index;
+				if constexpr (!minified) {
+					JSONIFIER_SKIP_WS();
+				}
+				if JSONIFIER_LIKELY (context.iter < context.endIter) {
+					if JSONIFIER_LIKELY (*context.iter == comma) {
+						++context.iter;
+						if constexpr (!minified) {
+							JSONIFIER_SKIP_WS();
+						}
+						continue;
+					} else if JSONIFIER_LIKELY (*context.iter == rBracket) {
+						if JSONIFIER_UNLIKELY (index != size) {
+							value.resize(index);
+						}
+						return;
+					}
+				}
+				value.resize(index);
+				context.parserPtr->template reportError<parse_errors::Missing_Array_End>(context);
+				base::skipToNextValue(context);
+				return;
+			}
+		}
+
+	  protected:
+		template<typename element_type_new> JSONIFIER_INLINE static bool parseElement(element_type_new& element, context_type& context) noexcept {
+			if constexpr (concepts::integer_t<element_type_new>) {
+				return parseIntegerSwar(element, context.iter, context.endIter);
+			} else {
+				return parseNumber(element, context.iter, context.endIter);
+			}
+		}
+	};
+
 	template<concepts::vector_t value_type, typename context_type, parse_options optionsNew> struct parse_impl<value_type, context_type, optionsNew, false> {
 		inline static constexpr parse_options options{ optionsNew };
 		using base = derailleur<options, context_type>;
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.currentArrayDepth;
 					++context.iter;
@@ -818,7 +894,13 @@ namespace jsonifier::internal {
 						const auto wsStart = context.iter;
 						JSONIFIER_SKIP_WS();
 						size_t wsSize{ static_cast<size_t>(context.iter - wsStart) };
-						if (auto size = value.size(); size > 0) {
+						if constexpr (options.reserveContainers && concepts::has_reserve<value_type> && !concepts::fixed_capacity_t<value_type> &&
+							!concepts::num_t<typename value_type::value_type>) {
+							value.reserve(countDirectChildren(context.iter, context.endIter));
+						}
+						if constexpr (concepts::num_t<typename value_type::value_type>) {
+							parse_numeric_array<value_type, context_type, options, false>::impl(value, context);
+						} else if (auto size = value.size(); size > 0) {
 							parseObjectsWithSize<true>(value, context, size, wsStart, wsSize);
 						} else {
 							parseObjects<true>(value, context, wsStart, wsSize);
@@ -873,14 +955,20 @@ namespace jsonifier::internal {
 		}
 
 		template<bool newLines> JSONIFIER_INLINE static void parseObjects(value_type& value, context_type& context, const auto wsStart = {}, size_t wsSize = {}) {
+			if JSONIFIER_UNLIKELY (isAtCapacity(value)) {
+				return base::rejectExcessValues(context);
+			}
 			parse<options, false>::impl(value.emplace_back(), context);
 
-			while (context.iter < context.endIter && *context.iter == comma) {
+			while (canRead<options>(context.iter, context.endIter) && *context.iter == comma) {
 				++context.iter;
 				JSONIFIER_SKIP_MATCHING_WS()
+				if JSONIFIER_UNLIKELY (isAtCapacity(value)) {
+					return base::rejectExcessValues(context);
+				}
 				parse<options, false>::impl(value.emplace_back(), context);
 			}
-			if JSONIFIER_LIKELY (context.iter < context.endIter && *context.iter == rBracket) {
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == rBracket) {
 				return;
 			} else {
 				context.parserPtr->template reportError<parse_errors::Missing_Array_End>(context);
@@ -894,7 +982,7 @@ namespace jsonifier::internal {
 		using base = derailleur<options, context_type>;
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.currentArrayDepth;
 					++context.iter;
@@ -958,6 +1046,12 @@ namespace jsonifier::internal {
 					}
 				}
 			}
+			base::rejectExcessValues(context);
+			if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == rBracket) {
+				++context.iter;
+				JSONIFIER_SKIP_WS()
+				--context.currentArrayDepth;
+			}
 		}
 	};
 
@@ -966,7 +1060,7 @@ namespace jsonifier::internal {
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
 			static constexpr auto memberCount = tuple_size_v<value_type>;
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.iter;
 					JSONIFIER_SKIP_WS()
@@ -1020,12 +1114,18 @@ namespace jsonifier::internal {
 		using base = derailleur<options, context_type>;
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.currentArrayDepth;
 					++context.iter;
 					if JSONIFIER_LIKELY (*context.iter != rBracket) {
-						if (auto size = value.size(); size > 0) {
+						if constexpr (options.reserveContainers && concepts::has_reserve<value_type> && !concepts::fixed_capacity_t<value_type> &&
+							!concepts::num_t<typename value_type::value_type>) {
+							value.reserve(countDirectChildren(context.iter, context.endIter));
+						}
+						if constexpr (concepts::num_t<typename value_type::value_type>) {
+							parse_numeric_array<value_type, context_type, options, true>::impl(value, context);
+						} else if (auto size = value.size(); size > 0) {
 							parseObjectsWithSize(value, context, size);
 						} else {
 							parseObjects(value, context);
@@ -1078,13 +1178,19 @@ namespace jsonifier::internal {
 		}
 
 		JSONIFIER_INLINE static void parseObjects(value_type& value, context_type& context) {
+			if JSONIFIER_UNLIKELY (isAtCapacity(value)) {
+				return base::rejectExcessValues(context);
+			}
 			parse<options, true>::impl(value.emplace_back(), context);
 
-			while (context.iter < context.endIter && *context.iter == comma) {
+			while (canRead<options>(context.iter, context.endIter) && *context.iter == comma) {
 				++context.iter;
+				if JSONIFIER_UNLIKELY (isAtCapacity(value)) {
+					return base::rejectExcessValues(context);
+				}
 				parse<options, true>::impl(value.emplace_back(), context);
 			}
-			if JSONIFIER_LIKELY (context.iter < context.endIter && *context.iter == rBracket) {
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == rBracket) {
 				return;
 			} else {
 				context.parserPtr->template reportError<parse_errors::Missing_Array_End>(context);
@@ -1098,7 +1204,7 @@ namespace jsonifier::internal {
 		using base = derailleur<options, context_type>;
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.currentArrayDepth;
 					++context.iter;
@@ -1108,11 +1214,11 @@ namespace jsonifier::internal {
 						for (size_t i = 0; i < value.size(); ++i) {
 							parse<options, true>::impl(*(iterNew++), context);
 
-							if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == comma) {
+							if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == comma) {
 								++context.iter;
 							}
 							JSONIFIER_ELSE_UNLIKELY(else) {
-								if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == rBracket) {
+								if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == rBracket) {
 									++context.iter;
 									--context.currentArrayDepth;
 									return;
@@ -1124,6 +1230,11 @@ namespace jsonifier::internal {
 								}
 							}
 						}
+						base::rejectExcessValues(context);
+						if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == rBracket) {
+							++context.iter;
+							--context.currentArrayDepth;
+						}
 					} else {
 						++context.iter;
 						--context.currentArrayDepth;
@@ -1147,7 +1258,7 @@ namespace jsonifier::internal {
 
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
 			static constexpr auto memberCount = tuple_size_v<value_type>;
-			if JSONIFIER_LIKELY (context.iter + 1 < context.endIter) {
+			if JSONIFIER_LIKELY (canRead<options, 1>(context.iter, context.endIter)) {
 				if JSONIFIER_LIKELY (*context.iter == lBracket) {
 					++context.iter;
 					++context.currentArrayDepth;
@@ -1251,10 +1362,56 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::decimal_t value_type, typename context_type, parse_options options, bool minified> struct parse_impl<value_type, context_type, options, minified> {
+		using base = derailleur<options, context_type>;
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			switch (decimal_parser<value_type::scale>::impl(value.units, context.iter, context.endIter)) {
+				case parse_errors::Success: {
+					if constexpr (!minified) {
+						JSONIFIER_SKIP_WS();
+					}
+					return;
+				}
+				case parse_errors::Decimal_Overflow: {
+					context.parserPtr->template reportError<parse_errors::Decimal_Overflow>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				case parse_errors::Decimal_Precision_Loss: {
+					context.parserPtr->template reportError<parse_errors::Decimal_Precision_Loss>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				default: {
+					context.parserPtr->template reportError<parse_errors::Invalid_Number_Value>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+			}
+		}
+	};
+
+	template<concepts::time_point_t value_type, typename context_type, parse_options options, bool minified> struct parse_impl<value_type, context_type, options, minified> {
+		using base = derailleur<options, context_type>;
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			if JSONIFIER_LIKELY (time_point_parser<value_type>::impl(value, context.iter, context.endIter)) {
+				if constexpr (!minified) {
+					JSONIFIER_SKIP_WS();
+				}
+				return;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				context.parserPtr->template reportError<parse_errors::Invalid_Timestamp_Value>(context);
+				base::skipToNextValue(context);
+				return;
+			}
+		}
+	};
+
 	template<concepts::bool_t value_type, typename context_type, parse_options options, bool minified> struct parse_impl<value_type, context_type, options, minified> {
 		using base = derailleur<options, context_type>;
 		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
-			if JSONIFIER_LIKELY ((context.iter + 3) < context.endIter && parseBool(value, context.iter)) {
+			if JSONIFIER_LIKELY (canRead<options, 3>(context.iter, context.endIter) && parseBool(value, context.iter)) {
 				if constexpr (!minified) {
 					JSONIFIER_SKIP_WS();
 				}
@@ -1471,10 +1628,7 @@ namespace jsonifier::internal {
 			base::skipToNextValue(context);
 			uint64_t newSize = context.iter - newPtr;
 			if JSONIFIER_LIKELY (newSize > 0) {
-				string newString{};
-				newString.resize(static_cast<size_t>(newSize));
-				std::memcpy(newString.data(), newPtr, static_cast<size_t>(newSize));
-				value = value_type{ *context.parserPtr, newString };
+				value = value_type{ string_view{ newPtr, static_cast<size_t>(newSize) } };
 			}
 			return;
 		}
@@ -1525,6 +1679,9 @@ namespace jsonifier::internal {
 					++context.iter;
 					++context.currentObjectDepth;
 					if JSONIFIER_LIKELY (**context.iter != rBrace) {
+						if constexpr (concepts::has_reserve<value_type>) {
+							value.reserve(value.size() + countDirectChildren(context.iter, context.endIter));
+						}
 						static thread_local typename value_type::key_type key{};
 						parse<options, minifiedOrInsideRepeated>::impl(key, context);
 
@@ -1586,6 +1743,9 @@ namespace jsonifier::internal {
 					++context.currentArrayDepth;
 					++context.iter;
 					if JSONIFIER_LIKELY ((context.iter < context.endIter) && **context.iter != rBracket) {
+						if constexpr (concepts::has_reserve<value_type> && !concepts::fixed_capacity_t<value_type>) {
+							value.reserve(countDirectChildren(context.iter, context.endIter));
+						}
 						if JSONIFIER_LIKELY (const size_t size = value.size(); size > 0) {
 							auto iterNew = value.begin();
 
@@ -1602,7 +1762,11 @@ namespace jsonifier::internal {
 						}
 
 						while (context.iter < context.endIter) {
-							parse<options, minifiedOrInsideRepeated>::impl(value.emplace_back(), context);
+							if JSONIFIER_UNLIKELY (isAtCapacity(value)) {
+								base::rejectExcessValues(context);
+							} else {
+								parse<options, minifiedOrInsideRepeated>::impl(value.emplace_back(), context);
+							}
 							if JSONIFIER_LIKELY (**context.iter == rBracket) {
 								++context.iter;
 								--context.currentArrayDepth;
@@ -1656,6 +1820,11 @@ namespace jsonifier::internal {
 								}
 							}
 						}
+						base::rejectExcessValues(context);
+						if JSONIFIER_LIKELY ((context.iter < context.endIter) && **context.iter == rBracket) {
+							++context.iter;
+							--context.currentArrayDepth;
+						}
 					} else {
 						++context.iter;
 						--context.currentArrayDepth;
@@ -1777,6 +1946,54 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::decimal_t value_type, typename context_type, parse_options options, bool minifiedOrInsideRepeated>
+	struct parse_partial_impl<value_type, context_type, options, minifiedOrInsideRepeated> {
+		using base = derailleur<options, context_type>;
+
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			auto newPtr = *context.iter;
+			switch (decimal_parser<value_type::scale>::impl(value.units, newPtr, *context.endIter)) {
+				case parse_errors::Success: {
+					++context.iter;
+					return;
+				}
+				case parse_errors::Decimal_Overflow: {
+					context.parserPtr->template reportError<parse_errors::Decimal_Overflow>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				case parse_errors::Decimal_Precision_Loss: {
+					context.parserPtr->template reportError<parse_errors::Decimal_Precision_Loss>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				default: {
+					context.parserPtr->template reportError<parse_errors::Invalid_Number_Value>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+			}
+		}
+	};
+
+	template<concepts::time_point_t value_type, typename context_type, parse_options options, bool minifiedOrInsideRepeated>
+	struct parse_partial_impl<value_type, context_type, options, minifiedOrInsideRepeated> {
+		using base = derailleur<options, context_type>;
+
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			auto newPtr = *context.iter;
+			if JSONIFIER_LIKELY (time_point_parser<value_type>::impl(value, newPtr, *context.endIter)) {
+				++context.iter;
+				return;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				context.parserPtr->template reportError<parse_errors::Invalid_Timestamp_Value>(context);
+				base::skipToNextValue(context);
+				return;
+			}
+		}
+	};
+
 	template<concepts::bool_t value_type, typename context_type, parse_options options, bool minifiedOrInsideRepeated>
 	struct parse_partial_impl<value_type, context_type, options, minifiedOrInsideRepeated> {
 		using base = derailleur<options, context_type>;
@@ -2002,10 +2219,7 @@ namespace jsonifier::internal {
 			base::skipToNextValue(context);
 			int64_t newSize = *context.iter - newPtr;
 			if JSONIFIER_LIKELY (newSize > 0) {
-				string newString{};
-				newString.resize(static_cast<size_t>(newSize));
-				std::memcpy(newString.data(), newPtr, static_cast<size_t>(newSize));
-				value = value_type{ *context.parserPtr, newString };
+				value = value_type{ string_view{ newPtr, static_cast<size_t>(newSize) } };
 			}
 			return;
 		}
@@ -2019,4 +2233,182 @@ namespace jsonifier::internal {
 			base::skipToNextValue(context);
 		}
 	};
-}
\ No newline at end of file
+
+	template<auto lhs, auto rhs> static constexpr bool isSameMember() noexcept {
+		if constexpr (std::is_same_v<decltype(lhs), decltype(rhs)>) {
+			return lhs == rhs;
+		} else {
+			return false;
+		}
+	}
+
+	template<typename value_type, size_t index, auto... memberPtrs> static constexpr bool isProjected() noexcept {
+		return (isSameMember<get<index>(core<value_type>::parseValue).memberPtr, memberPtrs>() || ...);
+	}
+
+	template<typename value_type, auto... memberPtrs, size_t... indices> static constexpr auto projectionMaskImpl(index_sequence<indices...>) noexcept {
+		return array<bool, (sizeof...(indices) > 0 ? sizeof...(indices) : 1)>{ { isProjected<value_type, indices, memberPtrs...>()... } };
+	}
+
+	template<typename value_type, typename projection_type> struct projection_traits;
+
+	template<typename value_type, auto... memberPtrs> struct projection_traits<value_type, projection<memberPtrs...>> {
+		static constexpr auto memberCount{ core_tuple_size<value_type> };
+		/// @brief For each member of core<value_type>::parseValue, whether the projection lists it.
+		static constexpr auto mask{ projectionMaskImpl<value_type, memberPtrs...>(make_index_sequence<memberCount>{}) };
+		static constexpr size_t projectedCount{ sizeof...(memberPtrs) };
+		static_assert(sizeof...(memberPtrs) > 0, "Sorry, but a jsonifier::projection must list at least one member.");
+		static_assert(
+			[] {
+				size_t matchedCount{};
+				for (size_t x = 0; x < memberCount; ++x) {
+					matchedCount += mask[x];
+				}
+				return matchedCount;
+			}() == sizeof...(memberPtrs),
+			"Sorry, but every member of a jsonifier::projection must be listed once, and in the core<value_type>::parseValue of the type being parsed.");
+	};
+
+	/// @brief Parses only the projected members of an object, skipping the others without dispatching them, and jumps to the object's closing brace
+	/// once the last projected member has been read. Duplicate keys count once per occurrence, so a projected key repeated later in the object may be
+	/// left behind by the jump.
+	template<typename value_type, typename projection_type, typename context_type, parse_options options, bool minified> struct parse_projection_impl {
+		using base	 = derailleur<options, context_type>;
+		using traits = projection_traits<value_type, projection_type>;
+
+		JSONIFIER_INLINE static void skipMember(context_type& context) noexcept {
+			base::template skipKeyStarted<value_type>(context);
+			++context.iter;
+			if constexpr (!minified) {
+				JSONIFIER_SKIP_WS();
+			}
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == colon) {
+				++context.iter;
+				if constexpr (!minified) {
+					JSONIFIER_SKIP_WS();
+				}
+				base::skipToNextValue(context);
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				context.parserPtr->template reportError<parse_errors::Missing_Colon>(context);
+				base::skipToNextValue(context);
+			}
+		}
+
+		JSONIFIER_INLINE static void closeObject(context_type& context) noexcept {
+			++context.iter;
+			--context.currentObjectDepth;
+			if constexpr (!minified) {
+				JSONIFIER_SKIP_WS();
+			}
+		}
+
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			if JSONIFIER_UNLIKELY (context.iter >= context.endIter) {
+				context.parserPtr->template reportError<parse_errors::Unexpected_String_End>(context);
+				return;
+			}
+			if JSONIFIER_UNLIKELY (*context.iter != lBrace) {
+				context.parserPtr->template reportError<parse_errors::Missing_Object_Start>(context);
+				base::skipToNextValue(context);
+				return;
+			}
+			++context.iter;
+			++context.currentObjectDepth;
+			if constexpr (!minified) {
+				JSONIFIER_SKIP_WS();
+			}
+			size_t remainingCount{ traits::projectedCount };
+			while (context.iter < context.endIter && *context.iter != rBrace) {
+				if JSONIFIER_UNLIKELY (*context.iter != quote) {
+					context.parserPtr->template reportError<parse_errors::Missing_String_Start>(context);
+					base::skipToNextValue(context);
+					return;
+				}
+				++context.iter;
+				const auto index = hash_map<value_type, string_view_ptr>::findIndex(context.iter, context.endIter);
+				if (index < traits::memberCount && traits::mask[index] && functionPtrs<parse_types_impl, value_type, context_type, options, minified>[index](value, context)) {
+					if (--remainingCount == 0) {
+						if JSONIFIER_UNLIKELY (!base::template skipToEndOfValue<lBrace, rBrace>(context)) {
+							context.parserPtr->template reportError<parse_errors::Unexpected_String_End>(context);
+							return;
+						}
+						--context.currentObjectDepth;
+						if constexpr (!minified) {
+							JSONIFIER_SKIP_WS();
+						}
+						return;
+					}
+				} else {
+					skipMember(context);
+				}
+				if constexpr (!minified) {
+					JSONIFIER_SKIP_WS();
+				}
+				if (canRead<options>(context.iter, context.endIter) && *context.iter == comma) {
+					++context.iter;
+					if constexpr (!minified) {
+						JSONIFIER_SKIP_WS();
+					}
+				} else {
+					break;
+				}
+			}
+			if JSONIFIER_LIKELY (canRead<options>(context.iter, context.endIter) && *context.iter == rBrace) {
+				closeObject(context);
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				context.parserPtr->template reportError<parse_errors::Missing_Object_End>(context);
+			}
+		}
+	};
+
+	/// @brief The structural-tape counterpart of parse_projection_impl. With partialRead nothing past the object is read anyway, so the parse simply
+	/// stops once the last projected member has been read.
+	template<typename value_type, typename projection_type, typename context_type, parse_options options> struct parse_projection_partial_impl {
+		using base	 = derailleur<options, context_type>;
+		using traits = projection_traits<value_type, projection_type>;
+
+		JSONIFIER_INLINE static void impl(value_type& value, context_type& context) noexcept {
+			if JSONIFIER_UNLIKELY (context.iter + 1 >= context.endIter) {
+				return;
+			}
+			if JSONIFIER_UNLIKELY (**context.iter != lBrace) {
+				context.parserPtr->template reportError<parse_errors::Missing_Object_Start>(context);
+				return;
+			}
+			++context.iter;
+			++context.currentObjectDepth;
+			size_t remainingCount{ traits::projectedCount };
+			while (context.iter < context.endIter && **context.iter != rBrace) {
+				if JSONIFIER_UNLIKELY (**context.iter != quote) {
+					context.parserPtr->template reportError<parse_errors::Missing_String_Start>(context);
+					return;
+				}
+				const auto index = hash_map<value_type, string_view_ptr>::findIndex((*context.iter) + 1, *context.endIter);
+				if (index < traits::memberCount && traits::mask[index] &&
+					functionPtrs<parse_types_partial_impl, value_type, context_type, options, false>[index](value, context)) {
+					if (--remainingCount == 0) {
+						context.iter = context.endIter;
+						break;
+					}
+				} else {
+					base::template skipKey<value_type>(context);
+					if JSONIFIER_UNLIKELY (context.iter >= context.endIter || **context.iter != colon) {
+						context.parserPtr->template reportError<parse_errors::Missing_Colon>(context);
+						return;
+					}
+					++context.iter;
+					base::skipToNextValue(context);
+				}
+				if (context.iter < context.endIter && **context.iter == comma) {
+					++context.iter;
+				} else {
+					break;
+				}
+			}
+			--context.currentObjectDepth;
+		}
+	};
+
+}
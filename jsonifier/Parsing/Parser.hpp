@@ -57,6 +57,9 @@ namespace jsonifier::internal {
 		}
 
 		mutable parser<derived_type>* parserPtr{};
+		mutable const bracket_match* brackets{};
+		mutable uint64_t bracketCount{};
+		mutable uint64_t bracketCursor{};
 		mutable int64_t remainingMemberCount{};
 		mutable int64_t currentObjectDepth{};
 		mutable int64_t currentArrayDepth{};
@@ -96,25 +99,38 @@ namespace jsonifier::internal {
 
 	template<typename value_type, typename context_type, parse_options optionsNew, bool minified> struct parse_partial_impl;
 	template<typename value_type, typename context_type, parse_options optionsNew, bool minified> struct parse_impl;
+	template<typename value_type, typename projection_type, typename context_type, parse_options options, bool minified> struct parse_projection_impl;
+	template<typename value_type, typename projection_type, typename context_type, parse_options options> struct parse_projection_partial_impl;
 
-	template<typename value_type, size_t currentIndex = 0> static constexpr size_t countTotalNonRepeatedMembers(size_t currentCount = 1) {
-		if constexpr (currentIndex < core_tuple_size<value_type>) {
-			constexpr auto newSubTuple = internal::get<currentIndex>(core<jsonifier::internal::remove_cvref_t<value_type>>::parseValue);
-			using member_type		   = typename jsonifier::internal::remove_cvref_t<decltype(newSubTuple)>::member_type;
-			if constexpr (concepts::jsonifier_object_t<member_type>) {
-				currentCount += countTotalNonRepeatedMembers<member_type>();
-			}
-			++currentCount;
-			return countTotalNonRepeatedMembers<value_type, currentIndex + 1>(currentCount);
+	template<typename value_type> static constexpr size_t countTotalNonRepeatedMembers();
+
+	template<typename value_type, size_t index> static constexpr size_t countMemberNonRepeatedMembers() {
+		constexpr auto newSubTuple = internal::get<index>(core<jsonifier::internal::remove_cvref_t<value_type>>::parseValue);
+		using member_type		   = typename jsonifier::internal::remove_cvref_t<decltype(newSubTuple)>::member_type;
+		if constexpr (concepts::jsonifier_object_t<member_type>) {
+			return countTotalNonRepeatedMembers<member_type>() + 1;
 		} else {
-			return currentCount;
+			return 1;
 		}
 	}
 
+	template<typename value_type, size_t... indices> static constexpr size_t countTotalNonRepeatedMembersImpl(index_sequence<indices...>) {
+		size_t currentCount{ 1 };
+		((currentCount += countMemberNonRepeatedMembers<value_type, indices>()), ...);
+		return currentCount;
+	}
+
+	/// @brief Counts value_type's members and, recursively, those of its object members, as a fold so that the constexpr depth follows the nesting
+	/// of the schema rather than its member count.
+	template<typename value_type> static constexpr size_t countTotalNonRepeatedMembers() {
+		return countTotalNonRepeatedMembersImpl<value_type>(make_index_sequence<core_tuple_size<value_type>>{});
+	}
+
 	template<parse_options options, bool minifiedOrInsideRepeated> struct parse {
 		template<typename value_type_new, typename context_type> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type&& context) noexcept {
 			using value_type = remove_cvref_t<value_type_new>;
 			if constexpr (options.partialRead) {
+				derailleur<options, context_type>::refillTape(context);
 				if constexpr (concepts::map_t<value_type> || concepts::jsonifier_object_t<value_type>) {
 					if constexpr (concepts::map_t<value_type> || minifiedOrInsideRepeated) {
 						parse_partial_impl<value_type, context_type, options, true>::impl(value, context);
@@ -151,124 +167,197 @@ namespace jsonifier::internal {
 
 		template<parse_options options = parse_options{}, typename value_type, typename buffer_type>
 		JSONIFIER_INLINE bool parseJson(value_type&& object, buffer_type&& in) noexcept {
-			if constexpr (options.partialRead) {
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			if constexpr (concepts::padded_input_t<buffer_type> && !options.paddedInput) {
+				return parseJson<withPaddedInput<options>()>(object, in);
+			} else if constexpr (options.detectMinified) {
+				const string_view trimmed{ trimSurroundingWhitespace(in) };
+				if (looksMinified(trimmed.data(), trimmed.data() + trimmed.size()) && parseJson<withMinified<options, true>()>(object, trimmed)) {
+					return true;
+				}
+				return parseJson<withMinified<options, false>()>(object, in);
+			} else if constexpr (options.partialRead) {
 				static constexpr parse_options optionsNew{ options };
 				constexpr parse_context_partial<derived_type, string_view_ptr*> context{ constEval(parse_context_partial<derived_type, string_view_ptr*>{}) };
-				auto rootIter = getBeginIter(in);
-				auto endIter  = getEndIter(in);
-				derivedRef.section.template reset<options.minified>(rootIter, static_cast<size_t>(endIter - rootIter));
-				context.rootIter			 = derivedRef.section.begin();
-				context.iter				 = derivedRef.section.begin();
-				context.endIter				 = derivedRef.section.end();
+				if constexpr (options.validateJson) {
+					if (!derivedRef.validateJson(in)) {
+						return false;
+					}
+				}
+				indexPartialInput<options>(context, getBeginIter(in), getEndIter(in));
 				context.remainingMemberCount = static_cast<int64_t>(countTotalNonRepeatedMembers<value_type>());
 				context.parserPtr			 = this;
 				auto newSize				 = static_cast<uint64_t>((context.endIter - context.iter) / 2);
-				if (derivedRef.stringBuffer.size() < newSize) {
-					derivedRef.stringBuffer.resize(newSize);
+				derivedRef.getScratch().reserveParseBuffer(newSize);
+				derivedRef.getScratch().errors.clear();
+				if JSONIFIER_UNLIKELY (!context.iter) {
+					reportError<parse_errors::No_Input>(context);
+					return false;
 				}
+				parse<optionsNew, areWeInsideRepeated<value_type>()>::impl(object, context);
+				return derivedRef.getScratch().errors.size() > 0 ? false : true;
+			} else {
+				static constexpr parse_options optionsNew{ options };
+				constexpr parse_context<derived_type, string_view_ptr> context{ constEval(parse_context<derived_type, string_view_ptr>{}) };
+				context.rootIter  = getBeginIter(in);
+				context.iter	  = context.rootIter;
+				context.endIter	  = getEndIter(in);
+				context.parserPtr = this;
+				auto newSize	  = static_cast<uint64_t>((context.endIter - context.iter) / 2);
+				derivedRef.getScratch().reserveParseBuffer(newSize);
 				if constexpr (options.validateJson) {
 					if (!derivedRef.validateJson(in)) {
 						return false;
 					}
 				}
-				derivedRef.errors.clear();
+				derivedRef.getScratch().errors.clear();
 				if JSONIFIER_UNLIKELY (!context.iter) {
 					reportError<parse_errors::No_Input>(context);
 					return false;
 				}
-				parse<optionsNew, areWeInsideRepeated<value_type>()>::impl(object, context);
-				return derivedRef.errors.size() > 0 ? false : true;
+				parse<optionsNew, options.minified>::impl(object, context);
+				return (context.currentObjectDepth != 0)		? (reportError<parse_errors::Imbalanced_Object_Braces>(context), false)
+					: (context.currentArrayDepth != 0)			? (reportError<parse_errors::Imbalanced_Array_Brackets>(context), false)
+					: (context.iter < context.endIter)			? (reportError<parse_errors::Unfinished_Input>(context), false)
+					: derivedRef.getScratch().errors.size() > 0 ? false
+																: true;
+			}
+		}
+
+		/// @brief Parses only the members of object listed in projection_type, a jsonifier::projection, leaving the rest of the object unvisited once
+		/// the last of them has been read.
+		template<parse_options options, concepts::projection_t projection_type, concepts::jsonifier_object_t value_type, typename buffer_type>
+		JSONIFIER_INLINE bool parseJson(value_type&& object, buffer_type&& in) noexcept {
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			using object_type = remove_cvref_t<value_type>;
+			if constexpr (concepts::padded_input_t<buffer_type> && !options.paddedInput) {
+				return parseJson<withPaddedInput<options>(), projection_type>(object, in);
+			} else if constexpr (options.detectMinified) {
+				const string_view trimmed{ trimSurroundingWhitespace(in) };
+				if (looksMinified(trimmed.data(), trimmed.data() + trimmed.size()) && parseJson<withMinified<options, true>(), projection_type>(object, trimmed)) {
+					return true;
+				}
+				return parseJson<withMinified<options, false>(), projection_type>(object, in);
+			} else if constexpr (options.partialRead) {
+				static constexpr parse_options optionsNew{ options };
+				using context_type = parse_context_partial<derived_type, string_view_ptr*>;
+				constexpr context_type context{ constEval(context_type{}) };
+				if constexpr (options.validateJson) {
+					if (!derivedRef.validateJson(in)) {
+						return false;
+					}
+				}
+				indexPartialInput<options>(context, getBeginIter(in), getEndIter(in));
+				context.remainingMemberCount = std::numeric_limits<int64_t>::max();
+				context.parserPtr			 = this;
+				auto newSize				 = static_cast<uint64_t>((context.endIter - context.iter) / 2);
+				derivedRef.getScratch().reserveParseBuffer(newSize);
+				derivedRef.getScratch().errors.clear();
+				if JSONIFIER_UNLIKELY (!context.iter) {
+					reportError<parse_errors::No_Input>(context);
+					return false;
+				}
+				parse_projection_partial_impl<object_type, projection_type, const context_type&, optionsNew>::impl(object, context);
+				return derivedRef.getScratch().errors.size() > 0 ? false : true;
 			} else {
 				static constexpr parse_options optionsNew{ options };
-				constexpr parse_context<derived_type, string_view_ptr> context{ constEval(parse_context<derived_type, string_view_ptr>{}) };
+				using context_type = parse_context<derived_type, string_view_ptr>;
+				constexpr context_type context{ constEval(context_type{}) };
 				context.rootIter  = getBeginIter(in);
 				context.iter	  = context.rootIter;
 				context.endIter	  = getEndIter(in);
 				context.parserPtr = this;
 				auto newSize	  = static_cast<uint64_t>((context.endIter - context.iter) / 2);
-				if (derivedRef.stringBuffer.size() < newSize) {
-					derivedRef.stringBuffer.resize(newSize);
-				}
+				derivedRef.getScratch().reserveParseBuffer(newSize);
 				if constexpr (options.validateJson) {
 					if (!derivedRef.validateJson(in)) {
 						return false;
 					}
 				}
-				derivedRef.errors.clear();
+				derivedRef.getScratch().errors.clear();
 				if JSONIFIER_UNLIKELY (!context.iter) {
 					reportError<parse_errors::No_Input>(context);
 					return false;
 				}
-				parse<optionsNew, options.minified>::impl(object, context);
-				return (context.currentObjectDepth != 0) ? (reportError<parse_errors::Imbalanced_Object_Braces>(context), false)
-					: (context.currentArrayDepth != 0)	 ? (reportError<parse_errors::Imbalanced_Array_Brackets>(context), false)
-					: (context.iter < context.endIter)	 ? (reportError<parse_errors::Unfinished_Input>(context), false)
-					: derivedRef.errors.size() > 0		 ? false
-														 : true;
+				parse_projection_impl<object_type, projection_type, const context_type&, optionsNew, options.minified>::impl(object, context);
+				return (context.currentObjectDepth != 0)		? (reportError<parse_errors::Imbalanced_Object_Braces>(context), false)
+					: (context.iter < context.endIter)			? (reportError<parse_errors::Unfinished_Input>(context), false)
+					: derivedRef.getScratch().errors.size() > 0 ? false
+																: true;
 			}
 		}
 
 		template<typename value_type, parse_options options = parse_options{}, typename buffer_type>
 		JSONIFIER_INLINE bool parseManyJson(value_type&& object, buffer_type&& in) noexcept {
-			static constexpr parse_options optionsNew{ .validateJson = options.validateJson, .partialRead = false, .knownOrder = options.knownOrder, .minified = options.minified };
+			static constexpr parse_options optionsNew{ .validateJson = options.validateJson, .partialRead = false, .knownOrder = options.knownOrder, .minified = options.minified,
+				.reserveContainers = options.reserveContainers };
 			constexpr parse_context<derived_type, string_view_ptr> context{ constEval(parse_context<derived_type, string_view_ptr>{}) };
 			context.rootIter  = getBeginIter(in);
 			context.iter	  = context.rootIter;
 			context.endIter	  = getEndIter(in);
 			context.parserPtr = this;
 			auto newSize	  = static_cast<uint64_t>((context.endIter - context.iter) / 2);
-			if (derivedRef.stringBuffer.size() < newSize) {
-				derivedRef.stringBuffer.resize(newSize);
-			}
+			derivedRef.getScratch().reserveParseBuffer(newSize);
 			if constexpr (options.validateJson) {
 				if (!derivedRef.validateJson(in)) {
 					return false;
 				}
 			}
-			derivedRef.errors.clear();
+			derivedRef.getScratch().errors.clear();
 			if JSONIFIER_UNLIKELY (!context.iter) {
 				reportError<parse_errors::No_Input>(context);
 				return false;
 			}
 			while (context.iter < context.endIter) {
+				if JSONIFIER_UNLIKELY (isAtCapacity(object)) {
+					reportError<parse_errors::Capacity_Exceeded>(context);
+					return false;
+				}
 				parse<optionsNew, options.minified>::impl(object.emplace_back(), context);
 			}
 			return (context.currentObjectDepth != 0)						  ? (reportError<parse_errors::Imbalanced_Object_Braces>(context), false)
 				: (context.currentArrayDepth != 0)							  ? (reportError<parse_errors::Imbalanced_Array_Brackets>(context), false)
 				: (context.iter < context.endIter && !optionsNew.partialRead) ? (reportError<parse_errors::Unfinished_Input>(context), false)
-				: derivedRef.errors.size() > 0								  ? false
+				: derivedRef.getScratch().errors.size() > 0					  ? false
 																			  : true;
 		}
 
-		template<typename value_type, parse_options options = parse_options{}, concepts::string_t buffer_type> JSONIFIER_INLINE value_type parseJson(buffer_type&& in) noexcept {
-			if constexpr (options.partialRead) {
+		template<typename value_type, parse_options options = parse_options{}, typename buffer_type>
+			requires(concepts::string_t<buffer_type> || concepts::padded_input_t<buffer_type>)
+		JSONIFIER_INLINE value_type parseJson(buffer_type&& in) noexcept {
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			if constexpr (concepts::padded_input_t<buffer_type> && !options.paddedInput) {
+				return parseJson<value_type, withPaddedInput<options>()>(in);
+			} else if constexpr (options.detectMinified) {
+				const string_view trimmed{ trimSurroundingWhitespace(in) };
+				if (looksMinified(trimmed.data(), trimmed.data() + trimmed.size())) {
+					value_type object{ parseJson<value_type, withMinified<options, true>()>(trimmed) };
+					if (derivedRef.getScratch().errors.empty()) {
+						return object;
+					}
+				}
+				return parseJson<value_type, withMinified<options, false>()>(in);
+			} else if constexpr (options.partialRead) {
 				static constexpr parse_options optionsNew{ options };
 				constexpr parse_context_partial<derived_type, string_view_ptr*> context{ constEval(parse_context_partial<derived_type, string_view_ptr*>{}) };
-				auto rootIter = getBeginIter(in);
-				auto endIter  = getEndIter(in);
-				derivedRef.section.template reset<options.minified>(rootIter, static_cast<size_t>(endIter - rootIter));
-				context.rootIter			 = derivedRef.section.begin();
-				context.iter				 = derivedRef.section.begin();
-				context.endIter				 = derivedRef.section.end();
-				context.remainingMemberCount = countTotalNonRepeatedMembers<value_type>();
-				context.parserPtr			 = this;
-				auto newSize				 = static_cast<uint64_t>((context.endIter - context.iter) / 2);
-				if (derivedRef.stringBuffer.size() < newSize) {
-					derivedRef.stringBuffer.resize(newSize);
-				}
 				if constexpr (options.validateJson) {
 					if (!derivedRef.validateJson(in)) {
 						return jsonifier::internal::remove_cvref_t<value_type>{};
 					}
 				}
-				derivedRef.errors.clear();
+				indexPartialInput<options>(context, getBeginIter(in), getEndIter(in));
+				context.remainingMemberCount = countTotalNonRepeatedMembers<value_type>();
+				context.parserPtr			 = this;
+				auto newSize				 = static_cast<uint64_t>((context.endIter - context.iter) / 2);
+				derivedRef.getScratch().reserveParseBuffer(newSize);
+				derivedRef.getScratch().errors.clear();
 				if JSONIFIER_UNLIKELY (!context.iter) {
 					reportError<parse_errors::No_Input>(context);
 					return jsonifier::internal::remove_cvref_t<value_type>{};
 				}
 				value_type object{};
 				parse<optionsNew, areWeInsideRepeated<value_type>()>::impl(object, context);
-				return derivedRef.errors.size() > 0 ? jsonifier::internal::remove_cvref_t<value_type>{} : object;
+				return derivedRef.getScratch().errors.size() > 0 ? jsonifier::internal::remove_cvref_t<value_type>{} : object;
 			} else {
 				static constexpr parse_options optionsNew{ options };
 				constexpr parse_context<derived_type, string_view_ptr> context{ constEval(parse_context<derived_type, string_view_ptr>{}) };
@@ -277,15 +366,13 @@ namespace jsonifier::internal {
 				context.endIter	  = getEndIter(in);
 				context.parserPtr = this;
 				auto newSize	  = static_cast<uint64_t>((context.endIter - context.iter) / 2);
-				if (derivedRef.stringBuffer.size() < newSize) {
-					derivedRef.stringBuffer.resize(newSize);
-				}
+				derivedRef.getScratch().reserveParseBuffer(newSize);
 				if constexpr (options.validateJson) {
 					if (!derivedRef.validateJson(in)) {
 						return jsonifier::internal::remove_cvref_t<value_type>{};
 					}
 				}
-				derivedRef.errors.clear();
+				derivedRef.getScratch().errors.clear();
 				if JSONIFIER_UNLIKELY (!context.iter) {
 					reportError<parse_errors::No_Input>(context);
 					return jsonifier::internal::remove_cvref_t<value_type>{};
@@ -296,14 +383,79 @@ namespace jsonifier::internal {
 					: (context.currentArrayDepth != 0)	 ? (reportError<parse_errors::Imbalanced_Array_Brackets>(context), jsonifier::internal::remove_cvref_t<value_type>{})
 					: (context.iter < context.endIter && !optionsNew.partialRead)
 					? (reportError<parse_errors::Unfinished_Input>(context), jsonifier::internal::remove_cvref_t<value_type>{})
-					: derivedRef.errors.size() > 0 ? jsonifier::internal::remove_cvref_t<value_type>{}
-												   : object;
+					: derivedRef.getScratch().errors.size() > 0 ? jsonifier::internal::remove_cvref_t<value_type>{}
+																: object;
+			}
+		}
+
+		/// @brief options with detectMinified resolved to the given choice.
+		template<parse_options options, bool minified> static constexpr parse_options withMinified() noexcept {
+			parse_options newOptions{ options };
+			newOptions.minified		  = minified;
+			newOptions.detectMinified = false;
+			return newOptions;
+		}
+
+		/// @brief options with paddedInput set, for input whose type already guarantees the padding.
+		template<parse_options options> static constexpr parse_options withPaddedInput() noexcept {
+			parse_options newOptions{ options };
+			newOptions.paddedInput = true;
+			return newOptions;
+		}
+
+		template<typename buffer_type> JSONIFIER_INLINE static string_view trimSurroundingWhitespace(buffer_type& in) noexcept {
+			string_view_ptr begin{ getBeginIter(in) };
+			string_view_ptr end{ getEndIter(in) };
+			while (begin < end && whitespaceTable[static_cast<uint8_t>(*begin)]) {
+				++begin;
+			}
+			while (end > begin && whitespaceTable[static_cast<uint8_t>(end[-1])]) {
+				--end;
+			}
+			return string_view{ begin, static_cast<size_t>(end - begin) };
+		}
+
+		/// @brief Entries that stay indexed ahead of a lazily indexed tape's cursor at every value. Between two values the parse only steps over a
+		/// handful of commas, keys and colons, and anything that walks further asks for more through extendTape itself.
+		static constexpr int64_t tapeLookahead{ 64 };
+
+		/// @brief Inputs past which the bracket table's 32-bit tape indices could wrap, and which matchBrackets therefore indexes lazily instead.
+		static constexpr uint64_t maxBracketMatchedSize{ std::numeric_limits<uint32_t>::max() };
+
+		/// @brief Indexes the tape a partialRead parse runs over. With matchBrackets the whole input is indexed up front, since the bracket table needs
+		/// every close; otherwise, or when the input is too large for the table or its full tape cannot be allocated, only a first window is, and the
+		/// rest follows through extendTape as the parse advances, with context.brackets left null.
+		template<parse_options options, typename context_type> JSONIFIER_INLINE void indexPartialInput(context_type& context, string_view_ptr rootIter, string_view_ptr endIter) noexcept {
+			const size_t size{ static_cast<size_t>(endIter - rootIter) };
+			context.brackets	  = nullptr;
+			context.bracketCount  = 0;
+			context.bracketCursor = 0;
+			if (options.matchBrackets && size <= maxBracketMatchedSize && !derivedRef.getScratch().section.isTapeFixed()) {
+				derivedRef.getScratch().section.template reset<options.minified, true>(rootIter, size, options.paddedInput);
+				if JSONIFIER_LIKELY (derivedRef.getScratch().section.begin()) {
+					context.brackets	 = derivedRef.getScratch().section.getBrackets();
+					context.bracketCount = derivedRef.getScratch().section.getBracketCount();
+				}
+			}
+			if (!context.brackets) {
+				derivedRef.getScratch().section.template resetLazy<options.minified>(rootIter, size, options.paddedInput);
+			}
+			context.rootIter = derivedRef.getScratch().section.begin();
+			context.iter	 = derivedRef.getScratch().section.begin();
+			context.endIter	 = derivedRef.getScratch().section.end();
+		}
+
+		/// @brief Appends windows to a lazily indexed tape until tapeLookahead entries lie ahead of the cursor or the input is exhausted. A tape that
+		/// slides moves context.iter along with the entries it keeps.
+		template<parse_options options, typename context_type> JSONIFIER_INLINE void extendTape(context_type& context) noexcept {
+			while (context.endIter - context.iter < tapeLookahead && derivedRef.getScratch().section.template appendWindow<options.minified>(context.iter)) {
+				context.endIter = derivedRef.getScratch().section.end();
 			}
 		}
 
 		template<auto parseError, typename context_type>
 		void reportError(context_type& context, const std::source_location& sourceLocation = std::source_location::current()) noexcept {
-			derivedRef.errors.emplace_back(error::constructError<error_classes::Parsing, parseError>(getUnderlyingPtr(context.iter) - getUnderlyingPtr(context.rootIter),
+			derivedRef.getScratch().recordError(error::constructError<error_classes::Parsing, parseError>(getUnderlyingPtr(context.iter) - getUnderlyingPtr(context.rootIter),
 				getUnderlyingPtr(context.endIter) - getUnderlyingPtr(context.rootIter), getUnderlyingPtr(context.rootIter), sourceLocation));
 		}
 
@@ -317,7 +469,13 @@ namespace jsonifier::internal {
 		parser() noexcept : derivedRef{ initializeSelfRef() } {};
 
 		JSONIFIER_INLINE auto& getStringBuffer() noexcept {
-			return derivedRef.stringBuffer;
+			return derivedRef.getScratch().stringBuffer;
+		}
+
+		/// @brief The string buffer, grown first to hold at least sizeNew bytes unless the scratch is fixedCapacity, so callers check its size.
+		JSONIFIER_INLINE auto& getStringBuffer(uint64_t sizeNew) noexcept {
+			derivedRef.getScratch().reserveParseBuffer(sizeNew);
+			return derivedRef.getScratch().stringBuffer;
 		}
 
 		derived_type& initializeSelfRef() noexcept {
@@ -118,8 +118,13 @@ namespace jsonifier::internal {
 				auto newPtr = *iter;
 				++iter;
 				auto endPtr = *iter;
-				newPtr		= string_parser<optionsVal, decltype(newPtr), decltype(validatorRef.getStringBuffer().data())>::impl(newPtr, validatorRef.getStringBuffer().data(),
-						 static_cast<size_t>(endPtr - newPtr));
+				if JSONIFIER_UNLIKELY (validatorRef.getStringBuffer(static_cast<uint64_t>(endPtr - newPtr)).size() < static_cast<uint64_t>(endPtr - newPtr)) {
+					validatorRef.getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::Capacity_Exceeded>(
+						getUnderlyingPtr(*iter) - validatorRef.rootIter, validatorRef.endIter - validatorRef.rootIter, validatorRef.rootIter));
+					return false;
+				}
+				newPtr = string_parser<optionsVal, decltype(newPtr), decltype(validatorRef.getStringBuffer().data())>::impl(newPtr, validatorRef.getStringBuffer().data(),
+					static_cast<size_t>(endPtr - newPtr));
 				if JSONIFIER_LIKELY (newPtr) {
 					return true;
 				}
@@ -31,27 +31,59 @@ namespace jsonifier::internal {
 
 	template<json_structural_type typeNew, typename derived_type> struct validate_impl;
 
+	template<typename derived_type> class validator;
+
+	/// @brief The per-call state of validateJson, kept on the caller's stack so that the validator itself holds none.
+	template<typename derived_type> struct validate_context {
+		JSONIFIER_INLINE auto& getStringBuffer() noexcept {
+			return validatorPtr->getStringBuffer();
+		}
+
+		JSONIFIER_INLINE auto& getStringBuffer(uint64_t sizeNew) noexcept {
+			return validatorPtr->getStringBuffer(sizeNew);
+		}
+
+		JSONIFIER_INLINE std::vector<error>& getErrors() noexcept {
+			return validatorPtr->getErrors();
+		}
+
+		validator<derived_type>* validatorPtr{};
+		string_view_ptr rootIter{};
+		string_view_ptr endIter{};
+	};
+
 	template<typename derived_type> class validator {
 	  public:
 		template<json_structural_type typeNew, typename derived_type_new> friend struct validate_impl;
+		friend struct validate_context<derived_type>;
 
 		validator& operator=(const validator& other) = delete;
 		validator(const validator& other)			 = delete;
 
-		template<concepts::string_t string_type> JSONIFIER_INLINE bool validateJson(string_type&& in) noexcept {
-			derivedRef.errors.clear();
-			derivedRef.section.template reset<false>(in.data(), in.size());
-			rootIter = in.data();
-			endIter	 = in.data() + in.size();
-			string_view_ptr* iter{ derivedRef.section.begin() };
-			string_view_ptr* end{ derivedRef.section.end() };
+		template<typename string_type>
+			requires(concepts::string_t<string_type> || concepts::padded_input_t<string_type>)
+		JSONIFIER_INLINE bool validateJson(string_type&& in) noexcept {
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			derivedRef.getScratch().errors.clear();
+			derivedRef.getScratch().section.template reset<false>(in.data(), in.size(), concepts::padded_input_t<string_type>);
+			validate_context<derived_type> context{};
+			context.validatorPtr = this;
+			context.rootIter	 = in.data();
+			context.endIter		 = in.data() + in.size();
+			string_view_ptr* iter{ derivedRef.getScratch().section.begin() };
+			string_view_ptr* end{ derivedRef.getScratch().section.end() };
 			if (!iter) {
-				getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::No_Input>(0, 0, nullptr));
+				if (derivedRef.getScratch().section.isOverrun()) {
+					getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::Capacity_Exceeded>(0, 0, nullptr));
+				} else {
+					getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::No_Input>(0, 0, nullptr));
+				}
 				return false;
 			}
-			auto result = impl(iter, end, *this);
-			if (((static_cast<uint64_t>(*iter - rootIter) < in.size()) || derivedRef.errors.size() > 0ull)) {
-				getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::No_Input>(*iter - rootIter, endIter - rootIter, rootIter));
+			auto result = impl(iter, end, context);
+			if (((static_cast<uint64_t>(*iter - context.rootIter) < in.size()) || derivedRef.getScratch().errors.size() > 0ull)) {
+				getErrors().emplace_back(error::constructError<error_classes::Validating, validate_errors::No_Input>(*iter - context.rootIter, context.endIter - context.rootIter,
+					context.rootIter));
 				result = false;
 			}
 			return result;
@@ -59,8 +91,6 @@ namespace jsonifier::internal {
 
 	  protected:
 		derived_type& derivedRef{ initializeSelfRef() };
-		mutable string_view_ptr rootIter{};
-		mutable string_view_ptr endIter{};
 
 		validator() noexcept : derivedRef{ initializeSelfRef() } {};
 
@@ -93,7 +123,13 @@ namespace jsonifier::internal {
 		}
 
 		JSONIFIER_INLINE auto& getStringBuffer() noexcept {
-			return derivedRef.stringBuffer;
+			return derivedRef.getScratch().stringBuffer;
+		}
+
+		/// @brief The string buffer, grown first to hold at least sizeNew bytes unless the scratch is fixedCapacity, so callers check its size.
+		JSONIFIER_INLINE auto& getStringBuffer(uint64_t sizeNew) noexcept {
+			derivedRef.getScratch().reserveParseBuffer(sizeNew);
+			return derivedRef.getScratch().stringBuffer;
 		}
 
 		derived_type& initializeSelfRef() noexcept {
@@ -101,7 +137,7 @@ namespace jsonifier::internal {
 		}
 
 		std::vector<error>& getErrors() noexcept {
-			return derivedRef.errors;
+			return derivedRef.getScratch().errors;
 		}
 
 		~validator() noexcept = default;
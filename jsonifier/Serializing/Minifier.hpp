@@ -23,6 +23,7 @@
 /// Feb 3, 2023
 #pragma once
 
+#include <jsonifier/Utilities/WorkerPool.hpp>
 #include <jsonifier/Utilities/Simd.hpp>
 
 namespace jsonifier::internal {
@@ -54,183 +55,250 @@ namespace jsonifier::internal {
 		return returnValues;
 	}();
 
-	template<typename derived_type> class minifier {
-	  public:
-		JSONIFIER_INLINE minifier& operator=(const minifier& other) = delete;
-		JSONIFIER_INLINE minifier(const minifier& other)			= delete;
+	/// @brief Shuffle control for gathering the kept bytes of an eight byte word to its front, 0x80 lanes are zeroed (pshufb) or out of range (tbl).
+	inline constexpr array<uint64_t, 256> compactionTable{ []() constexpr {
+		array<uint64_t, 256> returnValues{};
+		for (uint64_t x = 0; x < 256; ++x) {
+			uint64_t shuffle{ 0x8080808080808080ull };
+			uint64_t outIndex{};
+			for (uint64_t y = 0; y < 8; ++y) {
+				if (x & (1ull << y)) {
+					shuffle &= ~(0xFFull << (outIndex * 8));
+					shuffle |= y << (outIndex * 8);
+					++outIndex;
+				}
+			}
+			returnValues[x] = shuffle;
+		}
+		return returnValues;
+	}() };
 
-		template<concepts::string_t string_type> JSONIFIER_INLINE auto minifyJson(string_type&& in) noexcept {
-			if JSONIFIER_UNLIKELY (derivedRef.stringBuffer.size() < in.size()) {
-				derivedRef.stringBuffer.resize(in.size());
+	/// @brief Tape-free minification. Each step's "whitespace outside of strings" mask is built with the same quote and escape tracking as
+	/// simd_string_reader, and every 64 byte lane is compacted straight into the output, so there is neither a tape nor per-token dispatch.
+	class minify_kernel : public simd_string_reader<false> {
+	  public:
+		/// @brief Compacts length bytes from in into out, which may be in itself, and returns the number of bytes written.
+		/// Nothing is written at or past outEnd. inStringNew is the string state at in, for resuming in the middle of a document.
+		JSONIFIER_INLINE uint64_t impl(string_view_ptr in, uint64_t length, char* out, char* outEnd, int64_t inStringNew = 0) noexcept {
+			JSONIFIER_ALIGN(bytesPerStep) char tail[bitsPerStep + 8];
+			resetKernel(in, length, inStringNew);
+			char* outIter{ out };
+			while (stringBlockReader.hasFullBlock()) {
+				string_view_ptr values{ stringBlockReader.fullBlock() };
+				collectDroppedBytes<false>(values);
+				outIter = compactStep(values, outIter, outEnd);
+				stringIndex += bitsPerStep;
 			}
-			derivedRef.errors.clear();
-			rootIter = in.data();
-			endIter	 = rootIter + in.size();
-			derivedRef.section.template reset<false>(rootIter, in.size());
-			string_view_ptr* iter{ derivedRef.section.begin() };
-			jsonifier::internal::remove_cvref_t<string_type> newString{};
-			if (!*iter) {
-				getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::No_Input>(*iter - rootIter, in.end() - in.begin(), rootIter));
-				return newString;
+			if (string_view_ptr values = stringBlockReader.getRemainder(); values) {
+				collectDroppedBytes<true>(values);
+				maskRemainder(length - stringIndex);
+				const uint64_t tailSize{ static_cast<uint64_t>(compactStep(values, tail, tail + sizeof(tail)) - tail) };
+				std::memcpy(outIter, tail, tailSize);
+				outIter += tailSize;
 			}
-			auto index = impl(iter, derivedRef.stringBuffer);
-			if (index != std::numeric_limits<uint32_t>::max()) {
-				newString.resize(index);
-				std::memcpy(newString.data(), derivedRef.stringBuffer.data(), index);
-				return newString;
-			} else {
-				return jsonifier::internal::remove_cvref_t<string_type>{};
+			return static_cast<uint64_t>(outIter - out);
+		}
+
+		/// @brief Counts the bytes impl() would keep if the range started outside (keptCounts[0]) or inside (keptCounts[1]) a string, without writing anything.
+		JSONIFIER_INLINE void count(string_view_ptr in, uint64_t length, uint64_t (&keptCounts)[2]) noexcept {
+			resetKernel(in, length, 0);
+			keptCounts[0] = 0;
+			keptCounts[1] = 0;
+			while (stringBlockReader.hasFullBlock()) {
+				collectDroppedBytes<false>(stringBlockReader.fullBlock());
+				countStep(keptCounts, length);
+				stringIndex += bitsPerStep;
+			}
+			if (string_view_ptr values = stringBlockReader.getRemainder(); values) {
+				collectDroppedBytes<true>(values);
+				countStep(keptCounts, length);
 			}
 		}
 
-		template<concepts::string_t string_type01, concepts::string_t string_type02> JSONIFIER_INLINE bool minifyJson(string_type01&& in, string_type02&& buffer) noexcept {
-			if JSONIFIER_UNLIKELY (derivedRef.stringBuffer.size() < in.size()) {
-				derivedRef.stringBuffer.resize(in.size());
+		/// @brief Whether the last range processed ended inside a string.
+		JSONIFIER_INLINE bool endsInString() const noexcept {
+			return prevInString != 0;
+		}
+
+	  protected:
+		JSONIFIER_ALIGN(bytesPerStep) uint64_t whitespaceBits[sixtyFourBitsPerStep] {};
+		JSONIFIER_ALIGN(bytesPerStep) uint64_t inStringBits[sixtyFourBitsPerStep] {};
+		jsonifier_simd_int_t kernelNextIsEscaped{};
+		jsonifier_simd_int_t kernelEscaped{};
+
+		JSONIFIER_INLINE void resetKernel(string_view_ptr in, uint64_t length, int64_t inStringNew) noexcept {
+			stringBlockReader.reset(in, length);
+			kernelNextIsEscaped = jsonifier_simd_int_t{};
+			kernelEscaped		= jsonifier_simd_int_t{};
+			prevInString		= inStringNew;
+			stringIndex			= 0;
+		}
+
+		template<bool collectAligned> JSONIFIER_INLINE void collectDroppedBytes(string_view_ptr values) noexcept {
+			jsonifier_simd_int_t newPtr[stridesPerStep];
+			collectStringValues<collectAligned>(values, newPtr);
+			simd::simd_int_t_holder rawStructurals{ .backslashes = simd::collectValues<'\\'>(newPtr), .whitespace = simd::collectWhitespaceIndices(newPtr),
+				.quotes = simd::collectValues<'"'>(newPtr), .op = {} };
+			collectEscapedCharacters(kernelEscaped, kernelNextIsEscaped, rawStructurals);
+			rawStructurals.quotes = simd::opAndNot(rawStructurals.quotes, kernelEscaped);
+			const jsonifier_simd_int_t inString{ simd::opClMul(rawStructurals.quotes, prevInString) };
+			simd::store(rawStructurals.whitespace, whitespaceBits);
+			simd::store(inString, inStringBits);
+			simd::store(simd::opAndNot(rawStructurals.whitespace, inString), newBits);
+		}
+
+		/// @brief Marks the padding past the end of the input as dropped.
+		JSONIFIER_INLINE void maskRemainder(uint64_t remaining) noexcept {
+			for (uint64_t x = 0; x < sixtyFourBitsPerStep; ++x) {
+				newBits[x] |= remaining >= (x + 1) * 64 ? 0 : (remaining <= x * 64 ? ~0ull : ~0ull << (remaining - x * 64));
 			}
-			derivedRef.errors.clear();
-			rootIter = in.data();
-			endIter	 = rootIter + in.size();
-			derivedRef.section.template reset<false>(rootIter, in.size());
-			string_view_ptr* iter{ derivedRef.section.begin() };
-			if (!*iter) {
-				getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::No_Input>(*iter - rootIter, in.end() - in.begin(), rootIter));
-				return false;
+		}
+
+		JSONIFIER_INLINE void countStep(uint64_t (&keptCounts)[2], uint64_t length) noexcept {
+			for (uint64_t x = 0; x < sixtyFourBitsPerStep; ++x) {
+				const uint64_t laneStart{ stringIndex + x * 64 };
+				const uint64_t validBits{ laneStart >= length ? 0 : (length - laneStart >= 64 ? ~0ull : ~(~0ull << (length - laneStart))) };
+				keptCounts[0] += static_cast<uint64_t>(popcnt(validBits & ~(whitespaceBits[x] & ~inStringBits[x])));
+				keptCounts[1] += static_cast<uint64_t>(popcnt(validBits & ~(whitespaceBits[x] & inStringBits[x])));
 			}
-			auto index = impl(iter, derivedRef.stringBuffer);
-			if JSONIFIER_LIKELY (index != std::numeric_limits<uint32_t>::max()) {
-				if JSONIFIER_LIKELY (buffer.size() != index) {
-					buffer.resize(index);
+		}
+
+		/// @brief Writes may run up to eight bytes past the compacted data, but never past the end of the word being read (which keeps in-place use safe) nor past outEnd.
+		JSONIFIER_INLINE char* compactStep(string_view_ptr values, char* outIter, char* outEnd) noexcept {
+			for (uint64_t x = 0; x < sixtyFourBitsPerStep; ++x) {
+				const uint64_t keptBits{ ~newBits[x] };
+				string_view_ptr lane{ values + x * 64 };
+				if JSONIFIER_LIKELY (keptBits == ~0ull) {
+					std::memmove(outIter, lane, 64);
+					outIter += 64;
+				} else if (keptBits) {
+					for (uint64_t y = 0; y < 8; ++y) {
+						outIter = compactWord(lane + y * 8, static_cast<uint8_t>(keptBits >> (y * 8)), outIter, outEnd);
+					}
 				}
-				std::memcpy(buffer.data(), derivedRef.stringBuffer.data(), index);
-				return true;
+			}
+			return outIter;
+		}
+
+		JSONIFIER_INLINE static char* compactWord(string_view_ptr values, uint8_t keptBits, char* outIter, char* outEnd) noexcept {
+			uint64_t word;
+			std::memcpy(&word, values, 8);
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_ANY_AVX)
+			const __m128i compacted{ _mm_shuffle_epi8(_mm_cvtsi64_si128(static_cast<int64_t>(word)), _mm_cvtsi64_si128(static_cast<int64_t>(compactionTable[keptBits]))) };
+			word = static_cast<uint64_t>(_mm_cvtsi128_si64(compacted));
+#elif JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_NEON)
+			word = vget_lane_u64(vreinterpret_u64_u8(vtbl1_u8(vcreate_u8(word), vcreate_u8(compactionTable[keptBits]))), 0);
+#else
+			uint64_t compacted{};
+			uint64_t shuffle{ compactionTable[keptBits] };
+			for (uint64_t x = 0; x < 8 && !(shuffle & 0x80); ++x, shuffle >>= 8) {
+				compacted |= ((word >> ((shuffle & 0x7) * 8)) & 0xFF) << (x * 8);
+			}
+			word = compacted;
+#endif
+			const uint64_t keptCount{ static_cast<uint64_t>(popcnt(keptBits)) };
+			if JSONIFIER_LIKELY (outEnd - outIter >= 8) {
+				std::memcpy(outIter, &word, 8);
 			} else {
-				return false;
+				std::memcpy(outIter, &word, keptCount);
 			}
+			return outIter + keptCount;
 		}
+	};
 
-	  protected:
-		derived_type& derivedRef{ initializeSelfRef() };
-		string_view_ptr rootIter{};
-		string_view_ptr endIter{};
+	/// @brief Inputs of at least this many bytes are minified and prettified in parallel chunks on the worker pool.
+	inline constexpr uint64_t parallelThreshold{ 32ull * 1024ull * 1024ull };
 
-		JSONIFIER_INLINE size_t getSize() const {
-			return endIter - rootIter;
+	template<typename derived_type> class minifier {
+	  public:
+		JSONIFIER_INLINE minifier& operator=(const minifier& other) = delete;
+		JSONIFIER_INLINE minifier(const minifier& other)			= delete;
+
+		template<concepts::string_t string_type> JSONIFIER_INLINE auto minifyJson(string_type&& in) noexcept {
+			jsonifier::internal::remove_cvref_t<string_type> newString{};
+			minifyJson(in, newString);
+			return newString;
 		}
 
-		JSONIFIER_INLINE void skipWs(int64_t& currentDistance, string_view_ptr previousPtr) noexcept {
-			while (whitespaceTable[static_cast<uint8_t>(previousPtr[--currentDistance])]) {
+		template<concepts::string_t string_type01, concepts::string_t string_type02> JSONIFIER_INLINE bool minifyJson(string_type01&& in, string_type02&& buffer) noexcept {
+			const uint64_t inSize{ static_cast<uint64_t>(in.size()) };
+			if JSONIFIER_UNLIKELY (buffer.size() < inSize) {
+				resizeUninitialized(buffer, inSize);
 			}
-		};
+			return impl(in.data(), inSize, buffer.data(), buffer);
+		}
 
-		template<typename iterator_type> JSONIFIER_INLINE void backTrackWs(int64_t& currentDistance, string_view_ptr& previousPtr, iterator_type iter) noexcept {
-			currentDistance = *iter - previousPtr;
-			skipWs(currentDistance, previousPtr);
-			++currentDistance;
+		/// @brief Minifies buffer over its own storage, no second buffer is touched.
+		template<concepts::string_t string_type> JSONIFIER_INLINE bool minifyJsonInPlace(string_type&& buffer) noexcept {
+			return impl(buffer.data(), static_cast<uint64_t>(buffer.size()), buffer.data(), buffer);
 		}
 
-		template<concepts::string_t string_type, typename iterator> JSONIFIER_INLINE uint64_t impl(iterator& iter, string_type&& out) noexcept {
-			auto previousPtr = *iter;
-			int64_t currentDistance{};
+	  protected:
+		derived_type& derivedRef{ initializeSelfRef() };
+
+		template<concepts::string_t string_type> JSONIFIER_INLINE bool impl(string_view_ptr in, uint64_t inSize, char* out, string_type& buffer) noexcept {
+			derivedRef.getScratch().errors.clear();
 			uint64_t index{};
-			++iter;
-
-			while (*iter) {
-				switch (jsonTypes[static_cast<uint8_t>(*previousPtr)]) {
-					case json_structural_type::string: {
-						backTrackWs(currentDistance, previousPtr, iter);
-						if JSONIFIER_LIKELY (currentDistance > 0) {
-							std::memcpy(&out[index], previousPtr, static_cast<uint64_t>(currentDistance));
-							index += static_cast<uint64_t>(currentDistance);
-						} else {
-							this->getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::Invalid_String_Length>(
-								static_cast<int64_t>(getUnderlyingPtr(iter) - this->rootIter), static_cast<int64_t>(this->endIter - this->rootIter), this->rootIter));
-							return std::numeric_limits<uint32_t>::max();
-						}
-						break;
-					}
-					case json_structural_type::comma: {
-						out[index] = ',';
-						++index;
-						break;
-					}
-					case json_structural_type::number: {
-						currentDistance = 0;
-						while (!whitespaceTable[static_cast<uint8_t>(previousPtr[++currentDistance])] && ((previousPtr + currentDistance) < (*iter))) {
-						}
-						if JSONIFIER_LIKELY (currentDistance > 0) {
-							std::memcpy(&out[index], previousPtr, static_cast<uint64_t>(currentDistance));
-							index += static_cast<uint64_t>(currentDistance);
-						} else {
-							this->getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::Invalid_Number_Value>(
-								static_cast<int64_t>(getUnderlyingPtr(iter) - this->rootIter), static_cast<int64_t>(this->endIter - this->rootIter), this->rootIter));
-							return std::numeric_limits<uint32_t>::max();
-						}
-						break;
-					}
-					case json_structural_type::colon: {
-						out[index] = ':';
-						++index;
-						break;
-					}
-					case json_structural_type::array_start: {
-						out[index] = '[';
-						++index;
-						break;
-					}
-					case json_structural_type::array_end: {
-						out[index] = ']';
-						++index;
-						break;
-					}
-					case json_structural_type::null: {
-						JSONIFIER_ALIGN(4) static constexpr char nullV[]{ "null" };
-						std::memcpy(&out[index], nullV, 4);
-						index += 4;
-						break;
-					}
-					case json_structural_type::boolean: {
-						if (*previousPtr == 'f') {
-							JSONIFIER_ALIGN(8) static constexpr char falseV[]{ "false" };
-							std::memcpy(&out[index], falseV, 5);
-							index += 5;
-						} else {
-							JSONIFIER_ALIGN(4) static constexpr char trueV[]{ "true" };
-							std::memcpy(&out[index], trueV, 4);
-							index += 4;
-						}
-						break;
-					}
-					case json_structural_type::object_start: {
-						out[index] = '{';
-						++index;
-						break;
-					}
-					case json_structural_type::object_end: {
-						out[index] = '}';
-						++index;
-						break;
-					}
-					case json_structural_type::unset: {
-						return index;
-					}
-					case json_structural_type::type_count:
-						[[fallthrough]];
-					case json_structural_type::error:
-						[[fallthrough]];
-					default: {
-						this->getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::Incorrect_Structural_Index>(
-							static_cast<int64_t>(getUnderlyingPtr(iter) - this->rootIter), static_cast<int64_t>(this->endIter - this->rootIter), this->rootIter));
-						return std::numeric_limits<uint32_t>::max();
-					}
+			bool unterminated{};
+			if (inSize >= parallelThreshold && in != out && worker_pool::getInstance().getThreadCount() > 1) {
+				index = parallelImpl(in, inSize, out, unterminated);
+			} else {
+				minify_kernel kernel{};
+				index		 = kernel.impl(in, inSize, out, out + inSize);
+				unterminated = kernel.endsInString();
+			}
+			if JSONIFIER_UNLIKELY (unterminated) {
+				getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::Invalid_String_Length>(static_cast<int64_t>(inSize),
+					static_cast<int64_t>(inSize), in));
+				buffer.resize(0);
+				return false;
+			} else if JSONIFIER_UNLIKELY (index == 0) {
+				getErrors().emplace_back(error::constructError<error_classes::Minifying, minify_errors::No_Input>(0, static_cast<int64_t>(inSize), in));
+				buffer.resize(0);
+				return false;
+			}
+			buffer.resize(index);
+			return true;
+		}
+
+		/// @brief Two passes over the worker pool: the first counts each chunk's kept bytes for both possible starting string states, a prefix over the chunks then
+		/// fixes every chunk's real starting state and output offset, and the second compacts all chunks straight into their final place in out.
+		JSONIFIER_INLINE uint64_t parallelImpl(string_view_ptr in, uint64_t inSize, char* out, bool& unterminated) noexcept {
+			auto& pool{ worker_pool::getInstance() };
+			const uint64_t chunkCount{ std::min(pool.getThreadCount() * 2, inSize / (parallelThreshold / 8)) };
+			std::vector<uint64_t> chunkStarts(chunkCount + 1);
+			for (uint64_t x = 1; x < chunkCount; ++x) {
+				uint64_t start{ inSize / chunkCount * x };
+				while (start < inSize && in[start - 1] == '\\') {
+					++start;
 				}
-				previousPtr = (*iter);
-				++iter;
+				chunkStarts[x] = std::max(start, chunkStarts[x - 1]);
 			}
-			if (previousPtr) {
-				out[index] = *previousPtr;
-				++index;
+			chunkStarts[chunkCount] = inSize;
+			std::vector<std::array<uint64_t, 2>> keptCounts(chunkCount);
+			std::vector<uint8_t> endsInString(chunkCount);
+			pool.forEach(chunkCount, [&](uint64_t index) {
+				minify_kernel chunkKernel{};
+				uint64_t counts[2]{};
+				chunkKernel.count(in + chunkStarts[index], chunkStarts[index + 1] - chunkStarts[index], counts);
+				keptCounts[index]	= { counts[0], counts[1] };
+				endsInString[index] = chunkKernel.endsInString();
+			});
+			std::vector<uint64_t> outOffsets(chunkCount + 1);
+			std::vector<int64_t> startsInString(chunkCount);
+			int64_t inString{};
+			for (uint64_t x = 0; x < chunkCount; ++x) {
+				startsInString[x] = inString;
+				outOffsets[x + 1] = outOffsets[x] + keptCounts[x][inString != 0];
+				inString ^= endsInString[x] ? -1 : 0;
 			}
-			return index;
+			unterminated = inString != 0;
+			pool.forEach(chunkCount, [&](uint64_t index) {
+				minify_kernel chunkKernel{};
+				chunkKernel.impl(in + chunkStarts[index], chunkStarts[index + 1] - chunkStarts[index], out + outOffsets[index], out + outOffsets[index + 1],
+					startsInString[index]);
+			});
+			return outOffsets[chunkCount];
 		}
 
 		JSONIFIER_INLINE minifier() noexcept : derivedRef{ initializeSelfRef() } {};
@@ -240,7 +308,7 @@ namespace jsonifier::internal {
 		}
 
 		JSONIFIER_INLINE std::vector<error>& getErrors() noexcept {
-			return derivedRef.errors;
+			return derivedRef.getScratch().errors;
 		}
 
 		JSONIFIER_INLINE ~minifier() noexcept = default;
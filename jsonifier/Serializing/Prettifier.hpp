@@ -38,32 +38,158 @@ namespace jsonifier {
 
 namespace jsonifier::internal {
 
+	/// @brief Number of input bytes indexed per tape window; the tape and, in sink mode, the output staging buffer stay bounded by this no matter the input size.
+	inline constexpr uint64_t prettifyWindowSize{ 1024ull * 1024ull };
+
+	/// @brief A newline followed by enough indentation characters to cover most nesting depths with a single copy.
+	template<char indentChar> inline constexpr array<char, 257> indentationBlock{ []() constexpr {
+		array<char, 257> returnValues{};
+		returnValues[0] = '\n';
+		for (uint64_t x = 1; x < returnValues.size(); ++x) {
+			returnValues[x] = indentChar;
+		}
+		return returnValues;
+	}() };
+
+	/// @brief Writes into a string that grows geometrically, the result ends up directly in the caller's string.
+	template<typename string_type> class prettify_buffer_writer {
+	  public:
+		static constexpr bool measuring{ false };
+
+		inline prettify_buffer_writer(string_type& bufferNew, uint64_t sizeHint) noexcept : buffer{ bufferNew } {
+			if (buffer.size() < sizeHint) {
+				resizeUninitialized(buffer, sizeHint);
+			}
+		}
+
+		inline void write(string_view_ptr values, uint64_t size) noexcept {
+			if JSONIFIER_UNLIKELY (index + size > buffer.size()) {
+				resizeUninitialized(buffer, (index + size) * 2);
+			}
+			std::memcpy(buffer.data() + index, values, size);
+			index += size;
+		}
+
+		inline void writeChar(char value) noexcept {
+			if JSONIFIER_UNLIKELY (index + 1 > buffer.size()) {
+				resizeUninitialized(buffer, (index + 1) * 2);
+			}
+			buffer[index] = value;
+			++index;
+		}
+
+		inline void finish() noexcept {
+			buffer.resize(index);
+		}
+
+	  protected:
+		string_type& buffer;
+		uint64_t index{};
+	};
+
+	/// @brief Stages output in a fixed buffer and hands it to sink(const char*, uint64_t) whenever it fills; values larger than the buffer bypass it.
+	template<typename sink_type> class prettify_sink_writer {
+	  public:
+		static constexpr bool measuring{ false };
+
+		inline prettify_sink_writer(sink_type& sinkNew, char* bufferNew, uint64_t capacityNew) noexcept : sink{ sinkNew }, buffer{ bufferNew }, capacity{ capacityNew } {};
+
+		inline void write(string_view_ptr values, uint64_t size) noexcept {
+			if JSONIFIER_UNLIKELY (index + size > capacity) {
+				finish();
+				if (size >= capacity) {
+					sink(values, size);
+					return;
+				}
+			}
+			std::memcpy(buffer + index, values, size);
+			index += size;
+		}
+
+		inline void writeChar(char value) noexcept {
+			if JSONIFIER_UNLIKELY (index == capacity) {
+				finish();
+			}
+			buffer[index] = value;
+			++index;
+		}
+
+		inline void finish() noexcept {
+			if (index > 0) {
+				sink(static_cast<string_view_ptr>(buffer), index);
+				index = 0;
+			}
+		}
+
+	  protected:
+		sink_type& sink;
+		char* buffer{};
+		uint64_t capacity{};
+		uint64_t index{};
+	};
+
+	/// @brief Writes into memory that is already known to be large enough, used once a parallel chunk's exact output range has been measured.
+	class prettify_pointer_writer {
+	  public:
+		static constexpr bool measuring{ false };
+
+		inline prettify_pointer_writer(char* outNew) noexcept : out{ outNew } {};
+
+		inline void write(string_view_ptr values, uint64_t size) noexcept {
+			std::memcpy(out, values, size);
+			out += size;
+		}
+
+		inline void writeChar(char value) noexcept {
+			*out = value;
+			++out;
+		}
+
+		inline void finish() noexcept {
+		}
+
+	  protected:
+		char* out{};
+	};
+
+	/// @brief Counts everything but newlines and indentation, which the prettifier tallies itself relative to the chunk's unknown starting indent.
+	class prettify_count_writer {
+	  public:
+		static constexpr bool measuring{ true };
+
+		inline void write(string_view_ptr, uint64_t size) noexcept {
+			count += size;
+		}
+
+		inline void writeChar(char) noexcept {
+			++count;
+		}
+
+		inline void finish() noexcept {
+		}
+
+		uint64_t count{};
+	};
+
+	/// @brief Token loop state, kept apart from the prettifier so parallel chunks each carry their own.
+	struct prettify_cursor {
+		string_view_ptr rootIter{};
+		string_view_ptr endIter{};
+		uint64_t newLineCount{};
+		int64_t indentSum{};
+		int64_t minIndent{};
+		int64_t indent{};
+		bool reachedEnd{};
+	};
+
 	template<typename derived_type> class prettifier {
 	  public:
 		inline prettifier& operator=(const prettifier& other) = delete;
 		inline prettifier(const prettifier& other)			  = delete;
 
 		template<prettify_options options = prettify_options{}, concepts::string_t string_type> inline auto prettifyJson(string_type&& in) noexcept {
-			if JSONIFIER_UNLIKELY (derivedRef.stringBuffer.size() < in.size() * 5) {
-				derivedRef.stringBuffer.resize(in.size() * 5);
-			}
-			static constexpr prettify_options optionsFinal{ options };
-			const auto* dataPtr = in.data();
-			derivedRef.errors.clear();
-			rootIter = dataPtr;
-			endIter	 = dataPtr + in.size();
-			derivedRef.section.template reset<true>(dataPtr, in.size());
-			string_view_ptr* iter{ derivedRef.section.begin() };
-			if JSONIFIER_UNLIKELY (!*iter) {
-				getErrors().emplace_back(
-					error::constructError<error_classes::Prettifying, prettify_errors::No_Input>(getUnderlyingPtr(iter) - dataPtr, in.end() - in.begin(), dataPtr));
-				return jsonifier::internal::remove_cvref_t<string_type>{};
-			}
 			jsonifier::internal::remove_cvref_t<string_type> newString{};
-			auto index = impl<optionsFinal>(iter, derivedRef.stringBuffer);
-			if JSONIFIER_LIKELY (index != std::numeric_limits<uint64_t>::max()) {
-				newString.resize(index);
-				std::memcpy(newString.data(), derivedRef.stringBuffer.data(), index);
+			if JSONIFIER_LIKELY (prettifyJson<options>(in, newString)) {
 				return newString;
 			} else {
 				return jsonifier::internal::remove_cvref_t<string_type>{};
@@ -72,196 +198,295 @@ namespace jsonifier::internal {
 
 		template<prettify_options options = prettify_options{}, concepts::string_t string_type01, concepts::string_t string_type02>
 		inline bool prettifyJson(string_type01&& in, string_type02&& buffer) noexcept {
-			if JSONIFIER_UNLIKELY (derivedRef.stringBuffer.size() < in.size() * 5) {
-				derivedRef.stringBuffer.resize(in.size() * 5);
-			}
-			static constexpr prettify_options optionsFinal{ options };
-			derivedRef.errors.clear();
-			const auto* dataPtr = in.data();
-			rootIter			= dataPtr;
-			endIter				= dataPtr + in.size();
-			derivedRef.section.template reset<true>(dataPtr, in.size());
-			string_view_ptr* iter{ derivedRef.section.begin() };
-			if JSONIFIER_UNLIKELY (!*iter) {
-				getErrors().emplace_back(
-					error::constructError<error_classes::Prettifying, prettify_errors::No_Input>(getUnderlyingPtr(iter) - dataPtr, in.end() - in.begin(), dataPtr));
-				return false;
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			if (in.size() >= parallelThreshold && worker_pool::getInstance().getThreadCount() > 1 && parallelImpl<options>(in.data(), in.size(), buffer)) {
+				return true;
 			}
-			auto index = impl<optionsFinal>(iter, derivedRef.stringBuffer);
-			if JSONIFIER_LIKELY (index != std::numeric_limits<uint64_t>::max()) {
-				if JSONIFIER_LIKELY (buffer.size() != index) {
-					buffer.resize(index);
-				}
-				std::memcpy(buffer.data(), derivedRef.stringBuffer.data(), index);
+			prettify_buffer_writer<jsonifier::internal::remove_cvref_t<string_type02>> writer{ buffer, in.size() * 2 };
+			if JSONIFIER_LIKELY (impl<options>(in.data(), in.size(), writer)) {
+				writer.finish();
 				return true;
 			} else {
+				buffer.resize(0);
+				return false;
+			}
+		}
+
+		/// @brief Streams the prettified output to sink(const char*, uint64_t) in chunks of at most prettifyWindowSize bytes (larger single values are passed through whole).
+		/// Memory use is bounded by the window size rather than the document size.
+		template<prettify_options options = prettify_options{}, concepts::string_t string_type, typename sink_type>
+			requires std::invocable<sink_type&, string_view_ptr, uint64_t>
+		inline bool prettifyJson(string_type&& in, sink_type&& sink) noexcept {
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			derivedRef.getScratch().reserveStringBuffer(prettifyWindowSize);
+			if JSONIFIER_UNLIKELY (derivedRef.getScratch().stringBuffer.size() < prettifyWindowSize) {
+				getErrors().clear();
+				getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Capacity_Exceeded>(0, static_cast<int64_t>(in.size()), in.data()));
 				return false;
 			}
+			prettify_sink_writer<jsonifier::internal::remove_cvref_t<sink_type>> writer{ sink, derivedRef.getScratch().stringBuffer.data(), prettifyWindowSize };
+			const bool result{ impl<options>(in.data(), in.size(), writer) };
+			writer.finish();
+			return result;
 		}
 
 	  protected:
 		derived_type& derivedRef{ initializeSelfRef() };
-		std::vector<json_structural_type> state{};
-		string_view_ptr rootIter{};
-		string_view_ptr endIter{};
 
-		inline prettifier() noexcept : derivedRef{ initializeSelfRef() } {
-			state.resize(64);
-		};
+		inline prettifier() noexcept : derivedRef{ initializeSelfRef() } {};
 
 		inline derived_type& initializeSelfRef() noexcept {
 			return *static_cast<derived_type*>(this);
 		}
 
 		inline std::vector<error>& getErrors() noexcept {
-			return derivedRef.errors;
+			return derivedRef.getScratch().errors;
 		}
 
-		template<prettify_options options, concepts::string_t string_type, typename iterator> inline uint64_t impl(iterator& iter, string_type&& out) noexcept {
-			string_view_ptr newPtr{};
-			uint64_t newSize{};
+		template<prettify_options options, typename writer_type> inline bool impl(string_view_ptr dataPtr, uint64_t size, writer_type& writer) noexcept {
+			derivedRef.getScratch().errors.clear();
+			prettify_cursor cursor{};
+			cursor.rootIter = dataPtr;
+			cursor.endIter	= dataPtr + size;
+			bool sawInput{};
+			if JSONIFIER_UNLIKELY (!processWindows<options>(derivedRef.getScratch().section, dataPtr, size, writer, cursor, sawInput)) {
+				return false;
+			}
+			if JSONIFIER_UNLIKELY (!sawInput) {
+				getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::No_Input>(0, static_cast<int64_t>(size), dataPtr));
+				return false;
+			}
+			return true;
+		}
+
+		/// @brief Splits the input at commas outside of strings, measures every chunk on the worker pool, turns the measured indent deltas into each chunk's
+		/// starting indent and output offset with a prefix pass, and then prettifies all chunks directly into their final range of buffer.
+		/// Returns false without touching the errors when the input needs the sequential path's handling (malformed nesting, stray bytes, no input).
+		template<prettify_options options, concepts::string_t string_type> inline bool parallelImpl(string_view_ptr dataPtr, uint64_t size, string_type& buffer) noexcept {
+			auto& pool{ worker_pool::getInstance() };
+			const uint64_t tentativeCount{ std::min(pool.getThreadCount() * 2, size / (parallelThreshold / 8)) };
+			std::vector<uint64_t> tentativeStarts(tentativeCount + 1);
+			for (uint64_t x = 1; x < tentativeCount; ++x) {
+				uint64_t start{ size / tentativeCount * x };
+				while (start < size && dataPtr[start - 1] == '\\') {
+					++start;
+				}
+				tentativeStarts[x] = std::max(start, tentativeStarts[x - 1]);
+			}
+			tentativeStarts[tentativeCount] = size;
+			std::vector<uint8_t> endsInString(tentativeCount);
+			pool.forEach(tentativeCount, [&](uint64_t index) {
+				minify_kernel chunkKernel{};
+				uint64_t counts[2]{};
+				chunkKernel.count(dataPtr + tentativeStarts[index], tentativeStarts[index + 1] - tentativeStarts[index], counts);
+				endsInString[index] = chunkKernel.endsInString();
+			});
+			std::vector<uint64_t> chunkStarts{ 0 };
+			bool inString{ endsInString[0] != 0 };
+			for (uint64_t x = 1; x < tentativeCount; ++x) {
+				uint64_t position{ tentativeStarts[x] };
+				bool inStringNew{ inString };
+				while (position < tentativeStarts[x + 1]) {
+					const char value{ dataPtr[position] };
+					if (inStringNew) {
+						if (value == '\\') {
+							++position;
+						} else if (value == '"') {
+							inStringNew = false;
+						}
+					} else if (value == ',') {
+						break;
+					} else if (value == '"') {
+						inStringNew = true;
+					}
+					++position;
+				}
+				if (position < tentativeStarts[x + 1]) {
+					chunkStarts.emplace_back(position);
+				}
+				inString ^= endsInString[x] != 0;
+			}
+			chunkStarts.emplace_back(size);
+			const uint64_t chunkCount{ chunkStarts.size() - 1 };
+			std::vector<prettify_cursor> cursors(chunkCount);
+			std::vector<uint64_t> byteCounts(chunkCount);
+			std::vector<uint8_t> valid(chunkCount);
+			pool.forEach(chunkCount, [&](uint64_t index) {
+				simd_string_reader<false> reader{};
+				prettify_count_writer writer{};
+				bool sawInput{};
+				valid[index]	  = processWindows<options>(reader, dataPtr + chunkStarts[index], chunkStarts[index + 1] - chunkStarts[index], writer, cursors[index], sawInput) &&
+					 sawInput && !cursors[index].reachedEnd;
+				byteCounts[index] = writer.count;
+			});
+			std::vector<uint64_t> outOffsets(chunkCount + 1);
+			std::vector<int64_t> startIndents(chunkCount);
 			int64_t indent{};
-			int64_t depth{};
-			uint64_t index{};
-			while (*iter) {
+			for (uint64_t x = 0; x < chunkCount; ++x) {
+				if (!valid[x] || indent + cursors[x].minIndent < 0) {
+					return false;
+				}
+				startIndents[x] = indent;
+				outOffsets[x + 1] = outOffsets[x] + byteCounts[x] + cursors[x].newLineCount * static_cast<uint64_t>(1 + indent) + static_cast<uint64_t>(cursors[x].indentSum);
+				indent += cursors[x].indent;
+			}
+			derivedRef.getScratch().errors.clear();
+			resizeUninitialized(buffer, outOffsets[chunkCount]);
+			pool.forEach(chunkCount, [&](uint64_t index) {
+				simd_string_reader<false> reader{};
+				prettify_pointer_writer writer{ buffer.data() + outOffsets[index] };
+				prettify_cursor cursor{};
+				cursor.rootIter = dataPtr;
+				cursor.endIter	= dataPtr + size;
+				cursor.indent	= startIndents[index];
+				bool sawInput{};
+				processWindows<options>(reader, dataPtr + chunkStarts[index], chunkStarts[index + 1] - chunkStarts[index], writer, cursor, sawInput);
+			});
+			return true;
+		}
+
+		/// @brief Indexes the input one window at a time; the last entry of each window is carried into the next, since its end is only known once the following structural is.
+		template<prettify_options options, typename reader_type, typename writer_type>
+		inline bool processWindows(reader_type& reader, string_view_ptr dataPtr, uint64_t size, writer_type& writer, prettify_cursor& cursor, bool& sawInput) noexcept {
+			reader.template resetWindowed<true>(dataPtr, size, prettifyWindowSize);
+			string_view_ptr* carryBegin{ reader.end() };
+			uint64_t carryCount{};
+			while (!cursor.reachedEnd && reader.template nextWindow<true>(carryBegin, carryCount)) {
+				string_view_ptr* iter{ reader.begin() };
+				string_view_ptr* tapeEnd{ reader.end() };
+				string_view_ptr* stop{ tapeEnd - 1 };
+				if (!reader.hasMoreWindows()) {
+					// A closing quote also marks the byte after it, which for the last string of the input lies past its end.
+					for (stop = tapeEnd; stop > iter && *(stop - 1) >= dataPtr + size; --stop) {
+					}
+				}
+				sawInput |= iter != tapeEnd;
+				if JSONIFIER_UNLIKELY (!processWindow<options>(iter, stop, writer, cursor)) {
+					return false;
+				}
+				carryBegin = iter;
+				carryCount = iter < tapeEnd ? static_cast<uint64_t>(tapeEnd - iter) : 0;
+			}
+			return true;
+		}
+
+		template<prettify_options options, typename writer_type> inline void writeNewLine(writer_type& writer, prettify_cursor& cursor) noexcept {
+			static constexpr auto& block{ indentationBlock<options.indentChar> };
+			static constexpr int64_t blockIndent{ static_cast<int64_t>(block.size() - 1) };
+			if constexpr (writer_type::measuring) {
+				++cursor.newLineCount;
+				cursor.indentSum += cursor.indent;
+			} else if JSONIFIER_LIKELY (cursor.indent <= blockIndent) {
+				writer.write(block.data(), static_cast<uint64_t>(cursor.indent) + 1);
+			} else {
+				writer.write(block.data(), block.size());
+				int64_t remaining{ cursor.indent - blockIndent };
+				while (remaining > 0) {
+					const int64_t chunk{ remaining < blockIndent ? remaining : blockIndent };
+					writer.write(block.data() + 1, static_cast<uint64_t>(chunk));
+					remaining -= chunk;
+				}
+			}
+		}
+
+		/// @brief Measuring runs start at an unknown indent, so instead of failing on a negative indent they record the lowest one reached.
+		template<typename writer_type, typename iterator> inline bool closeScope(iterator iter, prettify_cursor& cursor) noexcept {
+			if constexpr (writer_type::measuring) {
+				cursor.minIndent = std::min(cursor.minIndent, cursor.indent);
+			} else if JSONIFIER_UNLIKELY (cursor.indent < 0) {
+				getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(getUnderlyingPtr(iter) - cursor.rootIter,
+					cursor.endIter - cursor.rootIter, cursor.rootIter));
+				return false;
+			}
+			return true;
+		}
+
+		template<prettify_options options, typename writer_type, typename iterator>
+		inline bool processWindow(iterator& iter, iterator stop, writer_type& writer, prettify_cursor& cursor) noexcept {
+			string_view_ptr newPtr{};
+			while (iter < stop) {
 				switch (jsonTypes[static_cast<uint8_t>(**iter)]) {
 					case json_structural_type::string: {
 						newPtr = *iter;
 						++iter;
-						newSize = static_cast<uint64_t>((*iter) - newPtr);
-						std::memcpy(&out[index], newPtr, newSize);
-						index += newSize;
+						writer.write(newPtr, static_cast<uint64_t>((*iter) - newPtr));
 						break;
 					}
 					case json_structural_type::comma: {
-						static constexpr uint16_t commaNewLine{ packValues2(",\n") };
-						std::memcpy(&out[index], &commaNewLine, 2);
-						index += 2;
+						writer.writeChar(',');
+						writeNewLine<options>(writer, cursor);
 						++iter;
-						std::memset(&out[index], options.indentChar, static_cast<size_t>(indent));
-						index += static_cast<uint64_t>(indent);
 						break;
 					}
 					case json_structural_type::number: {
 						newPtr = (*iter);
 						++iter;
-						newSize = static_cast<uint64_t>((*iter) - newPtr);
-						std::memcpy(&out[index], newPtr, newSize);
-						index += newSize;
+						writer.write(newPtr, static_cast<uint64_t>((*iter) - newPtr));
 						break;
 					}
 					case json_structural_type::colon: {
 						static constexpr char valuesNew[]{ ':', options.indentChar };
-						static constexpr uint16_t colonIndentChar{ packValues2(valuesNew) };
-						std::memcpy(&out[index], &colonIndentChar, 2);
-						index += 2;
+						writer.write(valuesNew, 2);
 						++iter;
 						break;
 					}
 					case json_structural_type::array_start: {
-						out[index] = '[';
-						++index;
+						writer.writeChar('[');
 						++iter;
-						indent += options.indentSize;
-						if JSONIFIER_UNLIKELY (static_cast<size_t>(depth) >= state.size()) {
-							state.resize(state.size() * 2);
-						}
-						state[static_cast<uint64_t>(depth)] = json_structural_type::array_start;
-						++depth;
+						cursor.indent += options.indentSize;
 						if JSONIFIER_LIKELY (**iter != ']') {
-							out[index] = '\n';
-							++index;
-							std::memset(&out[index], options.indentChar, static_cast<size_t>(indent));
-							index += static_cast<uint64_t>(indent);
+							writeNewLine<options>(writer, cursor);
 						} else {
-							indent -= options.indentSize;
-							--depth;
-							out[index] = ']';
-							++index;
-							if (indent < 0) {
-								getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(
-									getUnderlyingPtr(iter) - rootIter, endIter - rootIter, rootIter));
-								return std::numeric_limits<uint64_t>::max();
-							}
+							cursor.indent -= options.indentSize;
+							writer.writeChar(']');
 							++iter;
 						}
 						break;
 					}
 					case json_structural_type::array_end: {
-						indent -= options.indentSize;
-						--depth;
-						if (indent < 0) {
-							getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(
-								getUnderlyingPtr(iter) - rootIter, endIter - rootIter, rootIter));
-							return std::numeric_limits<uint64_t>::max();
+						cursor.indent -= options.indentSize;
+						if JSONIFIER_UNLIKELY (!closeScope<writer_type>(iter, cursor)) {
+							return false;
 						}
-						out[index] = '\n';
-						++index;
-						std::memset(&out[index], options.indentChar, static_cast<size_t>(indent));
-						index += static_cast<uint64_t>(indent);
-						out[index] = ']';
-						++index;
+						writeNewLine<options>(writer, cursor);
+						writer.writeChar(']');
 						++iter;
 						break;
 					}
 					case json_structural_type::null: {
-						JSONIFIER_ALIGN(4) static constexpr char nullV[]{ "null" };
-						std::memcpy(&out[index], nullV, 4);
-						index += 4;
+						writer.write("null", 4);
 						++iter;
 						break;
 					}
 					case json_structural_type::boolean: {
 						if (**iter == 'f') {
-							JSONIFIER_ALIGN(8) static constexpr char falseV[]{ "false" };
-							std::memcpy(&out[index], falseV, 5);
-							index += 5;
-							++iter;
+							writer.write("false", 5);
 						} else {
-							JSONIFIER_ALIGN(4) static constexpr char trueV[]{ "true" };
-							std::memcpy(&out[index], trueV, 4);
-							index += 4;
-							++iter;
+							writer.write("true", 4);
 						}
+						++iter;
 						break;
 					}
 					case json_structural_type::object_start: {
-						out[index] = '{';
-						++index;
+						writer.writeChar('{');
 						++iter;
-						indent += options.indentSize;
-						if JSONIFIER_UNLIKELY (static_cast<size_t>(depth) >= state.size()) {
-							state.resize(state.size() * 2);
-						}
-						state[static_cast<uint64_t>(depth)] = json_structural_type::object_start;
-						++depth;
+						cursor.indent += options.indentSize;
 						if (**iter != '}') {
-							out[index] = '\n';
-							++index;
-							std::memset(&out[index], options.indentChar, static_cast<size_t>(indent));
-							index += static_cast<uint64_t>(indent);
+							writeNewLine<options>(writer, cursor);
 						} else {
-							--depth;
-							out[index] = '}';
-							++index;
+							cursor.indent -= options.indentSize;
+							writer.writeChar('}');
 							++iter;
 						}
 						break;
 					}
 					case json_structural_type::object_end: {
-						indent -= options.indentSize;
-						--depth;
-						if (indent < 0) {
-							getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(
-								getUnderlyingPtr(iter) - rootIter, endIter - rootIter, rootIter));
-							return std::numeric_limits<uint64_t>::max();
+						cursor.indent -= options.indentSize;
+						if JSONIFIER_UNLIKELY (!closeScope<writer_type>(iter, cursor)) {
+							return false;
 						}
-						out[index] = '\n';
-						++index;
-						std::memset(&out[index], options.indentChar, static_cast<size_t>(indent));
-						index += static_cast<uint64_t>(indent);
-						out[index] = '}';
-						++index;
+						writeNewLine<options>(writer, cursor);
+						writer.writeChar('}');
 						++iter;
 						break;
 					}
@@ -270,16 +495,17 @@ namespace jsonifier::internal {
 					case json_structural_type::error:
 						[[fallthrough]];
 					case json_structural_type::unset: {
-						return index;
+						cursor.reachedEnd = true;
+						return true;
 					}
 					default: {
-						getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(getUnderlyingPtr(iter) - rootIter,
-							endIter - rootIter, rootIter));
-						return std::numeric_limits<uint64_t>::max();
+						getErrors().emplace_back(error::constructError<error_classes::Prettifying, prettify_errors::Incorrect_Structural_Index>(getUnderlyingPtr(iter) - cursor.rootIter,
+							cursor.endIter - cursor.rootIter, cursor.rootIter));
+						return false;
 					}
 				}
 			}
-			return index;
+			return true;
 		}
 
 		inline ~prettifier() noexcept = default;
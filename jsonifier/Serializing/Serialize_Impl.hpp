@@ -28,6 +28,8 @@
 #include <jsonifier/Parsing/Parser.hpp>
 #include <jsonifier/Utilities/TypeEntities.hpp>
 #include <jsonifier/Utilities/JsonEntity.hpp>
+#include <jsonifier/Utilities/Decimal.hpp>
+#include <jsonifier/Utilities/TimePoint.hpp>
 #include <expected>
 #include <algorithm>
 #include <assert.h>
@@ -68,6 +70,10 @@ namespace jsonifier::internal {
 			return 5;
 		} else if constexpr (concepts::num_t<value_type>) {
 			return 24;
+		} else if constexpr (concepts::decimal_t<value_type>) {
+			return 24;
+		} else if constexpr (concepts::time_point_t<value_type>) {
+			return 48;
 		} else if constexpr (concepts::vector_t<value_type>) {
 			return 4 + getPaddingSize<options, typename value_type::value_type>();
 		} else if constexpr (concepts::tuple_t<value_type>) {
@@ -186,7 +192,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = (paddingSize + (memberCount * context.indent * 4));
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					context.indent += options.indentSize;
@@ -197,7 +203,7 @@ namespace jsonifier::internal {
 				} else {
 					context.index = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + paddingSize) {
-						context.buffer.resize((context.index + paddingSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + paddingSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					*context.bufferPtr = lBrace;
@@ -236,7 +242,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * (paddingSize + context.indent);
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					context.indent += options.indentSize;
@@ -248,7 +254,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * paddingSize;
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					*context.bufferPtr = lBrace;
@@ -310,7 +316,7 @@ namespace jsonifier::internal {
 			static constexpr auto additionalSize{ getPaddingSize<options, value_type>() };
 			context.index = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 			if (context.buffer.size() <= context.index + additionalSize) {
-				context.buffer.resize((context.index + additionalSize) * 4);
+				resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 				context.bufferPtr = context.buffer.data() + context.index;
 			}
 			static constexpr auto size = std::tuple_size_v<jsonifier::internal::remove_reference_t<value_type>>;
@@ -372,7 +378,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * (paddingSize + context.indent) * 4;
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					context.indent += options.indentSize;
@@ -384,7 +390,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * paddingSize;
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					*context.bufferPtr = lBracket;
@@ -433,7 +439,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * (paddingSize + context.indent);
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					context.indent += options.indentSize;
@@ -445,7 +451,7 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * paddingSize;
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 					*context.bufferPtr = lBracket;
@@ -491,14 +497,14 @@ namespace jsonifier::internal {
 					const auto additionalSize = newSize * (paddingSize + context.indent);
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 				} else {
 					const auto additionalSize = newSize * paddingSize;
 					context.index			  = static_cast<size_t>(context.bufferPtr - context.buffer.data());
 					if (context.buffer.size() <= context.index + additionalSize) {
-						context.buffer.resize((context.index + additionalSize) * 4);
+						resizeUninitialized(context.buffer, (context.index + additionalSize) * 4);
 						context.bufferPtr = context.buffer.data() + context.index;
 					}
 				}
@@ -587,6 +593,18 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::decimal_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			context.bufferPtr = decimal_serializer<value_type::scale, value_type::quoted>::impl(context.bufferPtr, value.units);
+		}
+	};
+
+	template<concepts::time_point_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			context.bufferPtr = time_point_serializer<value_type>::impl(context.bufferPtr, value);
+		}
+	};
+
 	template<concepts::bool_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
 		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
 			static constexpr uint64_t falseVInt{ 435728179558 };
@@ -622,7 +640,7 @@ namespace jsonifier::internal {
 			const auto rawJson = value.rawJson();
 			const auto size	   = rawJson.size();
 			if (context.buffer.size() <= context.index + size) {
-				context.buffer.resize((context.index + size) * 4);
+				resizeUninitialized(context.buffer, (context.index + size) * 4);
 				context.bufferPtr = context.buffer.data() + context.index;
 			}
 			std::memcpy(context.bufferPtr, rawJson.data(), size);
@@ -71,20 +71,25 @@ namespace jsonifier::internal {
 		template<serialize_options optionsNew = serialize_options{}, typename value_type, concepts::buffer_like buffer_type>
 		JSONIFIER_INLINE bool serializeJson(value_type&& object, buffer_type&& buffer) noexcept {
 			static constexpr serialize_options options{ optionsNew };
-			serialize_context<decltype(derivedRef.stringBuffer)> context{ derivedRef.stringBuffer.data(), derivedRef.stringBuffer };
+			const scratch_limit_guard scratchGuard{ derivedRef.getScratch() };
+			derivedRef.getScratch().reserveStringBuffer(0);
+			serialize_context<decltype(derivedRef.getScratch().stringBuffer)> context{ derivedRef.getScratch().stringBuffer.data(), derivedRef.getScratch().stringBuffer };
 			serialize<options>::impl(object, context);
 			context.index = static_cast<size_t>(context.bufferPtr - context.buffer.data());
-			buffer.resize(context.index);
-			std::copy(derivedRef.stringBuffer.data(), derivedRef.stringBuffer.data() + context.index, buffer.data());
+			resizeUninitialized(buffer, context.index);
+			std::copy(derivedRef.getScratch().stringBuffer.data(), derivedRef.getScratch().stringBuffer.data() + context.index, buffer.data());
 			return true;
 		}
 
+		/// @brief Serializes into the core's string buffer and returns a view of it, valid until the next call on this core. The high-water mark is
+		/// applied by that next call rather than this one, so the view is never released from under the caller.
 		template<serialize_options optionsNew = serialize_options{}, typename value_type> JSONIFIER_INLINE string_view serializeJson(value_type&& object) noexcept {
 			static constexpr serialize_options options{ optionsNew };
-			serialize_context<decltype(derivedRef.stringBuffer)> context{ derivedRef.stringBuffer.data(), derivedRef.stringBuffer };
+			derivedRef.getScratch().reserveStringBuffer(0);
+			serialize_context<decltype(derivedRef.getScratch().stringBuffer)> context{ derivedRef.getScratch().stringBuffer.data(), derivedRef.getScratch().stringBuffer };
 			serialize<options>::impl(object, context);
 			context.index = static_cast<size_t>(context.bufferPtr - context.buffer.data());
-			return string_view{ derivedRef.stringBuffer.data(), context.index };
+			return string_view{ derivedRef.getScratch().stringBuffer.data(), context.index };
 		}
 
 	  protected:
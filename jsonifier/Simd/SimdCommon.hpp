@@ -246,6 +246,22 @@ namespace jsonifier::simd {
 		return gatherValues<jsonifier_simd_int_t>(valuesNew);
 	}
 
+	/// @brief Marks the '{' and '[' bytes of values, or the '}' and ']' bytes when close is set; each pair only differs in bit 0x20, so one compare per stride covers both.
+	template<bool close> JSONIFIER_INLINE static jsonifier_simd_int_t collectBracketIndices(const jsonifier_simd_int_t* values) noexcept {
+		JSONIFIER_ALIGN(bytesPerStep) jsonifier_string_parsing_type valuesNew[stridesPerStep];
+		const jsonifier_simd_int_t simdValue{ gatherValue<jsonifier_simd_int_t>(static_cast<uint8_t>(close ? '}' : '{')) };
+		const jsonifier_simd_int_t caseBit{ gatherValue<jsonifier_simd_int_t>(static_cast<uint8_t>(0x20)) };
+		valuesNew[0] = opCmpEqBitMask(simdValue, opOr(caseBit, values[0]));
+		valuesNew[1] = opCmpEqBitMask(simdValue, opOr(caseBit, values[1]));
+		valuesNew[2] = opCmpEqBitMask(simdValue, opOr(caseBit, values[2]));
+		valuesNew[3] = opCmpEqBitMask(simdValue, opOr(caseBit, values[3]));
+		valuesNew[4] = opCmpEqBitMask(simdValue, opOr(caseBit, values[4]));
+		valuesNew[5] = opCmpEqBitMask(simdValue, opOr(caseBit, values[5]));
+		valuesNew[6] = opCmpEqBitMask(simdValue, opOr(caseBit, values[6]));
+		valuesNew[7] = opCmpEqBitMask(simdValue, opOr(caseBit, values[7]));
+		return gatherValues<jsonifier_simd_int_t>(valuesNew);
+	}
+
 	template<bool minified> JSONIFIER_INLINE static simd_int_t_holder collectIndices(const jsonifier_simd_int_t* values) noexcept {
 		if constexpr (!minified) {
 			return simd_int_t_holder{ .backslashes = collectValues<'\\'>(values),
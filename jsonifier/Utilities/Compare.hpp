@@ -163,13 +163,130 @@ namespace jsonifier::internal {
 			}
 
 			if (lengthNew > 0 && *data == value) {
-				++data;
 				return data;
 			}
 			return static_cast<decltype(data)>(nullptr);
 		}
 	};
 
+	template<char delimiterNew, char terminatorNew, typename char_type> struct char_counter {
+		static constexpr char delimiter{ delimiterNew };
+		static constexpr char terminator{ terminatorNew };
+
+		/// @brief Counts the delimiters that precede the first terminator, scanning in simd-sized blocks.
+		JSONIFIER_INLINE static uint64_t countUntil(const char_type* data, uint64_t lengthNew) noexcept {
+			uint64_t count{};
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512)
+			if (countBlocks<2>(data, lengthNew, count)) {
+				return count;
+			}
+#endif
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512) || JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX2)
+			if (countBlocks<1>(data, lengthNew, count)) {
+				return count;
+			}
+#endif
+			if (countBlocks<0>(data, lengthNew, count)) {
+				return count;
+			}
+			while (lengthNew > 0 && *data != terminator) {
+				count += (*data == delimiter);
+				++data;
+				--lengthNew;
+			}
+			return count;
+		}
+
+	  protected:
+		template<uint64_t index> JSONIFIER_INLINE static bool countBlocks(const char_type*& data, uint64_t& lengthNew, uint64_t& count) noexcept {
+			using simd_type						 = typename get_type_at_index<simd::avx_list, index>::type::type::type;
+			using integer_type					 = typename get_type_at_index<simd::avx_list, index>::type::integer_type;
+			static constexpr uint64_t vectorSize = get_type_at_index<simd::avx_list, index>::type::bytesProcessed;
+			if (lengthNew >= vectorSize) {
+				const simd_type delimiterValue	= simd::gatherValue<simd_type>(static_cast<uint8_t>(delimiter));
+				const simd_type terminatorValue = simd::gatherValue<simd_type>(static_cast<uint8_t>(terminator));
+				JSONIFIER_ALIGN(64) char valuesToLoad[vectorSize];
+				simd_type chunk;
+				while (lengthNew >= vectorSize) {
+					std::memcpy(valuesToLoad, data, vectorSize);
+					chunk							 = simd::gatherValues<simd_type>(valuesToLoad);
+					integer_type delimiterMask		 = static_cast<integer_type>(simd::opCmpEq(chunk, delimiterValue));
+					const integer_type terminatorMask = static_cast<integer_type>(simd::opCmpEq(chunk, terminatorValue));
+					if JSONIFIER_UNLIKELY (terminatorMask != 0) {
+						delimiterMask &= static_cast<integer_type>((terminatorMask & (~terminatorMask + 1)) - 1);
+						count += static_cast<uint64_t>(popcnt(delimiterMask));
+						return true;
+					}
+					count += static_cast<uint64_t>(popcnt(delimiterMask));
+					lengthNew -= vectorSize;
+					data += vectorSize;
+				}
+			}
+			return false;
+		}
+	};
+
+	template<typename char_type> struct whitespace_skipper {
+		/// @brief Returns a pointer to the first non-whitespace byte in [data, data + lengthNew), or data + lengthNew if there is none.
+		/// Single separating spaces are stepped over bytewise; longer runs, such as a newline plus indentation, are matched in simd-sized blocks.
+		JSONIFIER_INLINE static const char_type* skip(const char_type* data, uint64_t lengthNew) noexcept {
+			if (lengthNew == 0 || !whitespaceTable[static_cast<uint8_t>(*data)]) {
+				return data;
+			}
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512)
+			if (skipBlocks<2>(data, lengthNew)) {
+				return data;
+			}
+#endif
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512) || JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX2)
+			if (skipBlocks<1>(data, lengthNew)) {
+				return data;
+			}
+#endif
+			if (skipBlocks<0>(data, lengthNew)) {
+				return data;
+			}
+			while (lengthNew > 0 && whitespaceTable[static_cast<uint8_t>(*data)]) {
+				++data;
+				--lengthNew;
+			}
+			return data;
+		}
+
+	  protected:
+		template<uint64_t index> JSONIFIER_INLINE static bool skipBlocks(const char_type*& data, uint64_t& lengthNew) noexcept {
+			using simd_type						 = typename get_type_at_index<simd::avx_list, index>::type::type::type;
+			using integer_type					 = typename get_type_at_index<simd::avx_list, index>::type::integer_type;
+			static constexpr uint64_t vectorSize = get_type_at_index<simd::avx_list, index>::type::bytesProcessed;
+			if (lengthNew >= vectorSize) {
+				const simd_type spaceValue	 = simd::gatherValue<simd_type>(static_cast<uint8_t>(' '));
+				const simd_type tabValue	 = simd::gatherValue<simd_type>(static_cast<uint8_t>('\t'));
+				const simd_type newLineValue = simd::gatherValue<simd_type>(static_cast<uint8_t>('\n'));
+				const simd_type returnValue	 = simd::gatherValue<simd_type>(static_cast<uint8_t>('\r'));
+				JSONIFIER_ALIGN(64) char valuesToLoad[vectorSize];
+				simd_type chunk;
+				while (lengthNew >= vectorSize) {
+					std::memcpy(valuesToLoad, data, vectorSize);
+					chunk = simd::gatherValues<simd_type>(valuesToLoad);
+					// Comparing the chunk against itself yields every lane set in this platform's mask layout, so clearing the whitespace lanes out of it
+					// leaves exactly the non-whitespace ones.
+					const integer_type laneMask = static_cast<integer_type>(simd::opCmpEq(chunk, chunk));
+					const integer_type whitespaceMask =
+						static_cast<integer_type>(simd::opCmpEq(chunk, spaceValue) | simd::opCmpEq(chunk, tabValue) | simd::opCmpEq(chunk, newLineValue) |
+							simd::opCmpEq(chunk, returnValue));
+					const integer_type valueMask = static_cast<integer_type>(laneMask & ~whitespaceMask);
+					if JSONIFIER_LIKELY (valueMask != 0) {
+						data += simd::postCmpTzcnt(valueMask);
+						return true;
+					}
+					lengthNew -= vectorSize;
+					data += vectorSize;
+				}
+			}
+			return false;
+		}
+	};
+
 	struct comparison {
 		template<typename char_type01, typename char_type02> JSONIFIER_INLINE static bool compare(const char_type01* lhs, char_type02* rhs, uint64_t lengthNew) noexcept {
 #if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_AVX512)
@@ -0,0 +1,183 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/IToStr.hpp>
+#include <jsonifier/Utilities/StrToI.hpp>
+#include <jsonifier/Utilities/Error.hpp>
+
+namespace jsonifier {
+
+	/// @brief Fixed-point number stored as a count of 10^-scale units, parsed and serialized without passing through a double.
+	/// @tparam scale Number of fractional digits, at most 18.
+	/// @tparam quoted Whether the value is serialized as a json string ("123.4500") rather than a bare number; both forms are accepted when parsing.
+	template<uint64_t scaleNew, bool quotedNew> struct decimal {
+		static_assert(scaleNew <= 18, "Sorry, but jsonifier::decimal supports at most 18 fractional digits.");
+		static constexpr uint64_t scale{ scaleNew };
+		static constexpr bool quoted{ quotedNew };
+		static constexpr int64_t unitsPerWhole{ internal::pow_tables<>::powerOfTenInt[scale] };
+
+		constexpr decimal() noexcept = default;
+
+		static constexpr decimal fromUnits(int64_t unitsNew) noexcept {
+			decimal returnValue{};
+			returnValue.units = unitsNew;
+			return returnValue;
+		}
+
+		constexpr int64_t rawUnits() const noexcept {
+			return units;
+		}
+
+		constexpr int64_t wholePart() const noexcept {
+			return units / unitsPerWhole;
+		}
+
+		constexpr int64_t fractionalPart() const noexcept {
+			return units % unitsPerWhole;
+		}
+
+		constexpr auto operator<=>(const decimal&) const noexcept = default;
+
+		int64_t units{};
+	};
+
+}
+
+namespace jsonifier::internal {
+
+	template<uint64_t scale> struct decimal_parser : public pow_tables<> {
+		/// @brief Accumulates the integer and fractional digits straight into the scaled integer, reporting overflow and any non-zero digit beyond the scale.
+		template<bool negative> JSONIFIER_INLINE static parse_errors parseDigits(int64_t& value, string_view_ptr& iter, string_view_ptr end) noexcept {
+			static constexpr uint64_t limit{ static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + static_cast<uint64_t>(negative) };
+			uint64_t units{};
+			if JSONIFIER_UNLIKELY (iter >= end || !JSONIFIER_IS_DIGIT(*iter)) {
+				return parse_errors::Invalid_Number_Value;
+			}
+			if (*iter == zero) {
+				++iter;
+				if JSONIFIER_UNLIKELY (iter < end && JSONIFIER_IS_DIGIT(*iter)) {
+					return parse_errors::Invalid_Number_Value;
+				}
+			} else {
+				while (iter < end && JSONIFIER_IS_DIGIT(*iter)) {
+					const uint64_t digit{ static_cast<uint64_t>(*iter - zero) };
+					if JSONIFIER_UNLIKELY (units > (limit - digit) / 10) {
+						return parse_errors::Decimal_Overflow;
+					}
+					units = units * 10 + digit;
+					++iter;
+				}
+			}
+			uint64_t fractionDigits{};
+			if (iter < end && *iter == decimal) {
+				++iter;
+				if JSONIFIER_UNLIKELY (iter >= end || !JSONIFIER_IS_DIGIT(*iter)) {
+					return parse_errors::Invalid_Number_Value;
+				}
+				while (iter < end && JSONIFIER_IS_DIGIT(*iter)) {
+					const uint64_t digit{ static_cast<uint64_t>(*iter - zero) };
+					if (fractionDigits < scale) {
+						if JSONIFIER_UNLIKELY (units > (limit - digit) / 10) {
+							return parse_errors::Decimal_Overflow;
+						}
+						units = units * 10 + digit;
+						++fractionDigits;
+					} else if JSONIFIER_UNLIKELY (digit != 0) {
+						return parse_errors::Decimal_Precision_Loss;
+					}
+					++iter;
+				}
+			}
+			if JSONIFIER_UNLIKELY (iter < end && (*iter == 'e' || *iter == 'E')) {
+				return parse_errors::Invalid_Number_Value;
+			}
+			const uint64_t multiplier{ powerOfTenUint[scale - fractionDigits] };
+			if JSONIFIER_UNLIKELY (units > limit / multiplier) {
+				return parse_errors::Decimal_Overflow;
+			}
+			units *= multiplier;
+			if constexpr (negative) {
+				value = static_cast<int64_t>(0 - units);
+			} else {
+				value = static_cast<int64_t>(units);
+			}
+			return parse_errors::Success;
+		}
+
+		JSONIFIER_INLINE static parse_errors impl(int64_t& value, string_view_ptr& iter, string_view_ptr end) noexcept {
+			const bool isQuoted{ iter < end && *iter == '"' };
+			iter += isQuoted;
+			parse_errors result{};
+			if (iter < end && *iter == minus) {
+				++iter;
+				result = parseDigits<true>(value, iter, end);
+			} else {
+				result = parseDigits<false>(value, iter, end);
+			}
+			if JSONIFIER_LIKELY (result == parse_errors::Success && isQuoted) {
+				if JSONIFIER_UNLIKELY (iter >= end || *iter != '"') {
+					return parse_errors::Invalid_Number_Value;
+				}
+				++iter;
+			}
+			return result;
+		}
+	};
+
+	template<uint64_t scale, bool quoted> struct decimal_serializer {
+		/// @brief Writes the whole part through to_chars and the fraction as exactly scale zero-padded digits, two at a time from the itoa pair table.
+		JSONIFIER_INLINE static char* impl(char* buf, int64_t value) noexcept {
+			if constexpr (quoted) {
+				*buf = '"';
+				++buf;
+			}
+			*buf = minus;
+			buf += (value < 0);
+			const uint64_t magnitude{ value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value) };
+			buf = to_chars<uint64_t>::impl(buf, magnitude / pow_tables<>::powerOfTenUint[scale]);
+			if constexpr (scale > 0) {
+				*buf = decimal;
+				++buf;
+				uint64_t fraction{ magnitude % pow_tables<>::powerOfTenUint[scale] };
+				char* fractionPtr{ buf + scale };
+				while (fractionPtr - buf >= 2) {
+					fractionPtr -= 2;
+					std::memcpy(fractionPtr, fiwb<void>::charTable02 + (fraction % 100), 2);
+					fraction /= 100;
+				}
+				if (fractionPtr != buf) {
+					*buf = static_cast<char>(zero + fraction);
+				}
+				buf += scale;
+			}
+			if constexpr (quoted) {
+				*buf = '"';
+				++buf;
+			}
+			return buf;
+		}
+	};
+
+}
@@ -60,16 +60,20 @@ namespace jsonifier::internal {
 		No_Input				  = 14,
 		Unfinished_Input		  = 15,
 		Unexpected_String_End	  = 16,
+		Decimal_Overflow		  = 17,
+		Decimal_Precision_Loss	  = 18,
+		Invalid_Timestamp_Value	  = 19,
+		File_Read_Failure		  = 20,
+		Capacity_Exceeded		  = 21,
 	};
 
 	enum class serialize_errors { Success = 0 };
 
 	enum class minify_errors {
-		Success					   = 0,
-		No_Input				   = 1,
-		Invalid_String_Length	   = 2,
-		Invalid_Number_Value	   = 3,
-		Incorrect_Structural_Index = 4,
+		Success				  = 0,
+		No_Input			  = 1,
+		Invalid_String_Length = 2,
+		File_Read_Failure	  = 5,
 	};
 
 	enum class prettify_errors {
@@ -77,6 +81,7 @@ namespace jsonifier::internal {
 		No_Input				   = 1,
 		Exceeded_Max_Depth		   = 2,
 		Incorrect_Structural_Index = 3,
+		Capacity_Exceeded		   = 4,
 	};
 
 	enum class validate_errors {
@@ -95,6 +100,8 @@ namespace jsonifier::internal {
 		Invalid_Escape_Characters	   = 12,
 		Missing_Comma_Or_Closing_Brace = 13,
 		No_Input					   = 14,
+		File_Read_Failure			   = 15,
+		Capacity_Exceeded			   = 16,
 	};
 
 	std::ostream& operator<<(std::ostream& os, parse_errors error) {
@@ -122,6 +129,11 @@ namespace jsonifier::internal {
 				{ static_cast<uint64_t>(parse_errors::No_Input), "No_Input" },
 				{ static_cast<uint64_t>(parse_errors::Unfinished_Input), "Unfinished_Input" },
 				{ static_cast<uint64_t>(parse_errors::Unexpected_String_End), "Unexpected_String_End" },
+				{ static_cast<uint64_t>(parse_errors::Decimal_Overflow), "Decimal_Overflow" },
+				{ static_cast<uint64_t>(parse_errors::Decimal_Precision_Loss), "Decimal_Precision_Loss" },
+				{ static_cast<uint64_t>(parse_errors::Invalid_Timestamp_Value), "Invalid_Timestamp_Value" },
+				{ static_cast<uint64_t>(parse_errors::File_Read_Failure), "File_Read_Failure" },
+				{ static_cast<uint64_t>(parse_errors::Capacity_Exceeded), "Capacity_Exceeded" },
 			} },
 		{ error_classes::Serializing,
 			std::unordered_map<uint64_t, string_view>{
@@ -132,8 +144,7 @@ namespace jsonifier::internal {
 				{ static_cast<uint64_t>(minify_errors::Success), "Success" },
 				{ static_cast<uint64_t>(minify_errors::No_Input), "No_Input" },
 				{ static_cast<uint64_t>(minify_errors::Invalid_String_Length), "Invalid_String_Length" },
-				{ static_cast<uint64_t>(minify_errors::Invalid_Number_Value), "Invalid_Number_Value" },
-				{ static_cast<uint64_t>(minify_errors::Incorrect_Structural_Index), "Incorrect_Structural_Index" },
+				{ static_cast<uint64_t>(minify_errors::File_Read_Failure), "File_Read_Failure" },
 			} },
 		{ error_classes::Prettifying,
 			std::unordered_map<uint64_t, string_view>{
@@ -141,6 +152,7 @@ namespace jsonifier::internal {
 				{ static_cast<uint64_t>(prettify_errors::No_Input), "No_Input" },
 				{ static_cast<uint64_t>(prettify_errors::Exceeded_Max_Depth), "Exceeded_Max_Depth" },
 				{ static_cast<uint64_t>(prettify_errors::Incorrect_Structural_Index), "Incorrect_Structural_Index" },
+				{ static_cast<uint64_t>(prettify_errors::Capacity_Exceeded), "Capacity_Exceeded" },
 			} },
 		{ error_classes::Validating,
 			std::unordered_map<uint64_t, string_view>{
@@ -159,6 +171,8 @@ namespace jsonifier::internal {
 				{ static_cast<uint64_t>(validate_errors::Invalid_Escape_Characters), "Invalid_Escape_Characters" },
 				{ static_cast<uint64_t>(validate_errors::Missing_Comma_Or_Closing_Brace), "Missing_Comma_Or_Closing_Brace" },
 				{ static_cast<uint64_t>(validate_errors::No_Input), "No_Input" },
+				{ static_cast<uint64_t>(validate_errors::File_Read_Failure), "File_Read_Failure" },
+				{ static_cast<uint64_t>(validate_errors::Capacity_Exceeded), "Capacity_Exceeded" },
 			} },
 	};
 
@@ -226,7 +240,7 @@ namespace jsonifier::internal {
 			errorClass	 = errorClassNew;
 			errorType	 = typeNew;
 			if (stringView) {
-				formatError(stringView);
+				formatError(string_view{ stringView, stringLength });
 			}
 		}
 
@@ -263,12 +277,9 @@ namespace jsonifier::internal {
 			const auto rstart	   = std::rbegin(errorString) + static_cast<int64_t>(errorString.size()) - errorIndex - 1ll;
 			const auto prevNewLine = std::find((std::min)(rstart + 1, std::rend(errorString)), std::rend(errorString), static_cast<V>('\n'));
 			localIndex			   = std::distance(rstart, prevNewLine) - 1ll;
-			auto endIndex{ std::end(errorString) - start >= 64 ? 64 : std::end(errorString) - start };
-			context = string{ start, static_cast<size_t>(endIndex) };
-			for (auto& c: context) {
-				if (c == '\t') {
-					c = ' ';
-				}
+			contextLength		   = static_cast<uint64_t>(std::end(errorString) - start >= maxContextLength ? maxContextLength : std::end(errorString) - start);
+			for (uint64_t x = 0; x < contextLength; ++x) {
+				context[x] = start[static_cast<int64_t>(x)] == '\t' ? ' ' : start[static_cast<int64_t>(x)];
 			}
 		}
 
@@ -285,7 +296,8 @@ namespace jsonifier::internal {
 			string returnValue{ "Error of Type: " + errorMap.at(errorClass).at(errorType) + ", at global index: " + std::to_string(errorIndex) + ", on line: " + std::to_string(line) +
 				", at local index: " + std::to_string(localIndex) };
 			if (stringView) {
-				returnValue += "\nHere's some of the string's values: " + collectValues(string{}, context) + string{ "\nThe Values: " + context };
+				const string contextString{ context.data(), contextLength };
+				returnValue += "\nHere's some of the string's values: " + collectValues(string{}, contextString) + string{ "\nThe Values: " + contextString };
 			}
 			returnValue += string{ "\nIn file: " } + location.file_name() + ", at: " + std::to_string(location.line()) + ":" + std::to_string(location.column()) +
 				", in function: " + location.function_name() + "().\n";
@@ -300,7 +312,11 @@ namespace jsonifier::internal {
 		int64_t errorIndex{};
 		int64_t localIndex{};
 		uint64_t errorType{};
-		string context{};
+		static constexpr int64_t maxContextLength{ 64 };
+
+		/// @brief The input following the error, kept inline so that recording an error never allocates.
+		array<char, maxContextLength> context{};
+		uint64_t contextLength{};
 		uint64_t line{};
 	};
 
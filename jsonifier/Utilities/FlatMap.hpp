@@ -0,0 +1,377 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/HashMap.hpp>
+#include <memory>
+#include <vector>
+
+namespace jsonifier::internal {
+
+	/// @brief Bump storage for flat_map keys: keys are packed back to back into blocks that are never reallocated, so views into them stay valid as the map grows.
+	class flat_map_key_arena {
+	  public:
+		static constexpr uint64_t initialBlockSize{ 1024 };
+
+		JSONIFIER_INLINE char* allocate(uint64_t length) noexcept {
+			if JSONIFIER_UNLIKELY (length > remaining) {
+				nextBlock(length);
+			}
+			char* returnValue{ cursor };
+			cursor += length;
+			remaining -= length;
+			return returnValue;
+		}
+
+		/// @brief Rewinds to the first block, keeping every block for reuse.
+		JSONIFIER_INLINE void reset() noexcept {
+			blockIndex = 0;
+			remaining  = 0;
+			cursor	   = nullptr;
+		}
+
+	  protected:
+		struct block {
+			std::unique_ptr<char[]> data{};
+			uint64_t size{};
+		};
+
+		std::vector<block> blocks{};
+		uint64_t blockIndex{};
+		uint64_t remaining{};
+		char* cursor{};
+
+		JSONIFIER_INLINE void nextBlock(uint64_t length) noexcept {
+			while (blockIndex < blocks.size()) {
+				auto& currentBlock = blocks[blockIndex];
+				++blockIndex;
+				if (currentBlock.size >= length) {
+					cursor	  = currentBlock.data.get();
+					remaining = currentBlock.size;
+					return;
+				}
+			}
+			const uint64_t blockSize{ (std::max)(length, blocks.empty() ? initialBlockSize : blocks.back().size * 2) };
+			blocks.emplace_back(block{ std::unique_ptr<char[]>{ new char[blockSize] }, blockSize });
+			blockIndex = blocks.size();
+			cursor	   = blocks.back().data.get();
+			remaining  = blockSize;
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	/// @brief Open-addressing hash map from string keys to values, and the recommended target for json objects with dynamic keys.
+	/// Entries live in one insertion-ordered vector of (key view, value) pairs whose key bytes are packed into a shared arena, so inserting a key costs a copy
+	/// into that arena instead of a node and a string allocation. Lookups probe an index table in groups of 16 control bytes, the same
+	/// compare-a-hash-byte-across-a-simd-lane scheme the compile-time simd_full_length map uses, and the parser reserves it from the tape when partialRead is set.
+	/// Erasing moves the last entry into the erased one's place, and the erased key's bytes are only reclaimed by clear().
+	template<typename key_type_new, typename mapped_type_new> class flat_map {
+	  public:
+		static_assert(concepts::string_t<key_type_new>, "Sorry, but jsonifier::flat_map only supports string keys.");
+
+		using key_type		 = key_type_new;
+		using mapped_type	 = mapped_type_new;
+		using key_view_type	 = jsonifier::string_view;
+		using value_type	 = std::pair<key_view_type, mapped_type>;
+		using size_type		 = uint64_t;
+		using iterator		 = typename std::vector<value_type>::iterator;
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+
+		JSONIFIER_INLINE flat_map() noexcept = default;
+
+		JSONIFIER_INLINE flat_map& operator=(flat_map&& other) noexcept = default;
+		JSONIFIER_INLINE flat_map(flat_map&& other) noexcept			= default;
+
+		JSONIFIER_INLINE flat_map(const flat_map& other) noexcept {
+			*this = other;
+		}
+
+		/// @brief Copies re-insert every entry, since the copied views have to point into this map's own arena.
+		JSONIFIER_INLINE flat_map& operator=(const flat_map& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				clear();
+				reserve(other.size());
+				for (const auto& [key, value]: other.entries) {
+					emplaceImpl(key, hasher(key)).first->second = value;
+				}
+			}
+			return *this;
+		}
+
+		JSONIFIER_INLINE flat_map(std::initializer_list<std::pair<key_view_type, mapped_type>> values) noexcept {
+			reserve(values.size());
+			for (const auto& [key, value]: values) {
+				(*this)[key] = value;
+			}
+		}
+
+		JSONIFIER_INLINE mapped_type& operator[](key_view_type key) noexcept {
+			return emplaceImpl(key, hasher(key)).first->second;
+		}
+
+		/// @brief Inserts value under key unless the key is already present, returning the entry and whether it was inserted.
+		template<typename... arg_types> JSONIFIER_INLINE std::pair<iterator, bool> tryEmplace(key_view_type key, arg_types&&... args) noexcept {
+			return emplaceImpl(key, hasher(key), internal::forward<arg_types>(args)...);
+		}
+
+		JSONIFIER_INLINE iterator find(key_view_type key) noexcept {
+			const uint32_t index{ findIndex(key, hasher(key)) };
+			return index == npos ? entries.end() : entries.begin() + index;
+		}
+
+		JSONIFIER_INLINE const_iterator find(key_view_type key) const noexcept {
+			const uint32_t index{ findIndex(key, hasher(key)) };
+			return index == npos ? entries.end() : entries.begin() + index;
+		}
+
+		JSONIFIER_INLINE bool contains(key_view_type key) const noexcept {
+			return findIndex(key, hasher(key)) != npos;
+		}
+
+		JSONIFIER_INLINE size_type erase(key_view_type key) noexcept {
+			const uint64_t hash{ hasher(key) };
+			const uint64_t slot{ findSlot(key, hash) };
+			if JSONIFIER_UNLIKELY (slot == npos) {
+				return 0;
+			}
+			const uint32_t index{ slots[slot] };
+			setControl(slot, deletedControl);
+			++tombstoneCount;
+			const uint32_t lastIndex{ static_cast<uint32_t>(entries.size() - 1) };
+			if (index != lastIndex) {
+				slots[findSlotOfIndex(entries[lastIndex].first, lastIndex)] = index;
+				entries[index]												= std::move(entries[lastIndex]);
+			}
+			entries.pop_back();
+			return 1;
+		}
+
+		/// @brief Sizes the entry vector and the index table for count entries, so that inserting them never rehashes.
+		JSONIFIER_INLINE void reserve(size_type count) noexcept {
+			entries.reserve(count);
+			if (groupCountFor(count) > groups.size()) {
+				rehash(count);
+			}
+		}
+
+		JSONIFIER_INLINE void clear() noexcept {
+			entries.clear();
+			keyArena.reset();
+			std::fill(groups.begin(), groups.end(), emptyGroup());
+			tombstoneCount = 0;
+		}
+
+		JSONIFIER_INLINE iterator begin() noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE iterator end() noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE const_iterator begin() const noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE const_iterator end() const noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return entries.size();
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return entries.empty();
+		}
+
+		JSONIFIER_INLINE bool operator==(const flat_map& other) const noexcept {
+			if (size() != other.size()) {
+				return false;
+			}
+			for (const auto& [key, value]: entries) {
+				const auto iter = other.find(key);
+				if (iter == other.end() || !(iter->second == value)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+	  protected:
+		using simd_type = internal::map_simd_t<16>;
+		static constexpr uint64_t groupWidth{ 16 };
+		static constexpr uint8_t emptyControl{ 0x80 };
+		static constexpr uint8_t deletedControl{ 0xFE };
+		static constexpr uint32_t npos{ std::numeric_limits<uint32_t>::max() };
+#if JSONIFIER_CHECK_FOR_INSTRUCTION(JSONIFIER_NEON)
+		static constexpr uint64_t bitsPerLane{ 4 };
+#else
+		static constexpr uint64_t bitsPerLane{ 1 };
+#endif
+
+		struct alignas(16) control_group {
+			uint8_t bytes[groupWidth];
+		};
+
+		std::vector<value_type> entries{};
+		std::vector<control_group> groups{};
+		std::vector<uint32_t> slots{};
+		internal::flat_map_key_arena keyArena{};
+		uint64_t tombstoneCount{};
+
+		static constexpr control_group emptyGroup() noexcept {
+			control_group returnValue{};
+			for (uint64_t x = 0; x < groupWidth; ++x) {
+				returnValue.bytes[x] = emptyControl;
+			}
+			return returnValue;
+		}
+
+		JSONIFIER_INLINE static uint64_t hasher(key_view_type key) noexcept {
+			return internal::rt_key_hasher<internal::prns[0]>{}.hashKeyRt(key.data(), key.size());
+		}
+
+		/// @brief Keeps the table at most 7/8 full, counting the tombstones left by erase.
+		JSONIFIER_INLINE static uint64_t groupCountFor(uint64_t count) noexcept {
+			const uint64_t slotCount{ (count * 8 + 6) / 7 };
+			return std::bit_ceil((std::max)(uint64_t{ 1 }, (slotCount + groupWidth - 1) / groupWidth));
+		}
+
+		JSONIFIER_INLINE static uint8_t controlByte(uint64_t hash) noexcept {
+			return static_cast<uint8_t>(hash & 0x7F);
+		}
+
+		JSONIFIER_INLINE static uint64_t clearLane(uint64_t matches, uint64_t lane) noexcept {
+			return matches & ~(((uint64_t{ 1 } << bitsPerLane) - 1) << (lane * bitsPerLane));
+		}
+
+		JSONIFIER_INLINE void setControl(uint64_t slot, uint8_t value) noexcept {
+			groups[slot / groupWidth].bytes[slot % groupWidth] = value;
+		}
+
+		JSONIFIER_INLINE uint64_t matchControl(uint64_t group, uint8_t value) const noexcept {
+			return simd::opCmpEq(simd::gatherValue<simd_type>(value), simd::gatherValues<simd_type>(groups[group].bytes));
+		}
+
+		/// @brief Probes group by group from the key's home group, checking every lane whose control byte matches the hash's low seven bits,
+		/// and stops at the first group that still has an empty lane.
+		JSONIFIER_INLINE uint64_t findSlot(key_view_type key, uint64_t hash) const noexcept {
+			if JSONIFIER_UNLIKELY (groups.empty()) {
+				return npos;
+			}
+			const uint64_t groupMask{ groups.size() - 1 };
+			const uint8_t control{ controlByte(hash) };
+			uint64_t group{ (hash >> 7) & groupMask };
+			for (uint64_t probes = 0; probes < groups.size(); ++probes) {
+				uint64_t matches{ matchControl(group, control) };
+				while (matches) {
+					const uint64_t lane{ simd::postCmpTzcnt(matches) };
+					const uint64_t slot{ group * groupWidth + lane };
+					const auto& entryKey = entries[slots[slot]].first;
+					if JSONIFIER_LIKELY (entryKey.size() == key.size() && internal::comparison::compare(entryKey.data(), key.data(), key.size())) {
+						return slot;
+					}
+					matches = clearLane(matches, lane);
+				}
+				if JSONIFIER_LIKELY (matchControl(group, emptyControl)) {
+					return npos;
+				}
+				group = (group + 1) & groupMask;
+			}
+			return npos;
+		}
+
+		JSONIFIER_INLINE uint32_t findIndex(key_view_type key, uint64_t hash) const noexcept {
+			const uint64_t slot{ findSlot(key, hash) };
+			return slot == npos ? npos : slots[slot];
+		}
+
+		/// @brief Locates the slot holding entry index, for re-pointing it after erase moves that entry.
+		JSONIFIER_INLINE uint64_t findSlotOfIndex(key_view_type key, uint32_t index) const noexcept {
+			const uint64_t hash{ hasher(key) };
+			const uint64_t groupMask{ groups.size() - 1 };
+			const uint8_t control{ controlByte(hash) };
+			uint64_t group{ (hash >> 7) & groupMask };
+			while (true) {
+				uint64_t matches{ matchControl(group, control) };
+				while (matches) {
+					const uint64_t lane{ simd::postCmpTzcnt(matches) };
+					const uint64_t slot{ group * groupWidth + lane };
+					if (slots[slot] == index) {
+						return slot;
+					}
+					matches = clearLane(matches, lane);
+				}
+				group = (group + 1) & groupMask;
+			}
+		}
+
+		/// @brief Claims the first empty lane on key's probe sequence; the caller has already made room.
+		JSONIFIER_INLINE void insertSlot(uint64_t hash, uint32_t index) noexcept {
+			const uint64_t groupMask{ groups.size() - 1 };
+			uint64_t group{ (hash >> 7) & groupMask };
+			while (true) {
+				if (const uint64_t empties = matchControl(group, emptyControl); empties) {
+					const uint64_t slot{ group * groupWidth + simd::postCmpTzcnt(empties) };
+					setControl(slot, controlByte(hash));
+					slots[slot] = index;
+					return;
+				}
+				group = (group + 1) & groupMask;
+			}
+		}
+
+		JSONIFIER_INLINE void rehash(uint64_t count) noexcept {
+			const uint64_t groupCount{ groupCountFor(count) };
+			groups.assign(groupCount, emptyGroup());
+			slots.assign(groupCount * groupWidth, npos);
+			tombstoneCount = 0;
+			for (uint64_t x = 0; x < entries.size(); ++x) {
+				insertSlot(hasher(entries[x].first), static_cast<uint32_t>(x));
+			}
+		}
+
+		template<typename... arg_types> JSONIFIER_INLINE std::pair<iterator, bool> emplaceImpl(key_view_type key, uint64_t hash, arg_types&&... args) noexcept {
+			if (const uint32_t index = findIndex(key, hash); index != npos) {
+				return { entries.begin() + index, false };
+			}
+			if JSONIFIER_UNLIKELY (groupCountFor(entries.size() + tombstoneCount + 1) > groups.size()) {
+				rehash((std::max)(entries.size() * 2, entries.size() + 1));
+			}
+			char* keyPtr{ keyArena.allocate(key.size()) };
+			if JSONIFIER_LIKELY (key.size() > 0) {
+				std::memcpy(keyPtr, key.data(), key.size());
+			}
+			const uint32_t index{ static_cast<uint32_t>(entries.size()) };
+			entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(keyPtr, key.size()), std::forward_as_tuple(internal::forward<arg_types>(args)...));
+			insertSlot(hash, index);
+			return { entries.begin() + index, true };
+		}
+	};
+
+}
@@ -98,6 +98,19 @@ namespace jsonifier::internal {
 		8724494295438506783ull, 9277533619161797917ull, 13495127262014153477ull, 2883303557104387784ull, 3039599040070277986ull, 4196273005435491662ull, 5417879022829474871ull,
 		6476778602757520149ull, 7959620869796075525ull, 8518936512742009562ull, 9635246566869230345ull } };
 
+	/// @brief Multiplied in after every chunk so that the order of the chunks matters; a plain xor of the chunks would collide for every seed
+	/// whenever two keys' chunks xor to the same value.
+	inline constexpr uint64_t hashMultiplier{ 0x9E3779B97F4A7C15ull };
+
+	/// @brief Murmur3's finalizer, so that bytes which differ only in the high bits of a chunk still reach the low bits the hash maps index with.
+	JSONIFIER_INLINE constexpr uint64_t finalizeHash(uint64_t value) noexcept {
+		value ^= value >> 33;
+		value *= 0xFF51AFD7ED558CCDull;
+		value ^= value >> 33;
+		value *= 0xC4CEB9FE1A85EC53ull;
+		return value ^ (value >> 33);
+	}
+
 	template<typename value_type> static constexpr value_type readBitsCt(string_view_ptr ptr) noexcept {
 		value_type chunk{};
 		for (uint64_t x = 0; x < sizeof(value_type); ++x) {
@@ -136,27 +149,27 @@ namespace jsonifier::internal {
 		constexpr uint64_t hashKeyCt(string_view_ptr value, uint64_t length) const noexcept {
 			uint64_t seed64{ seed };
 			while (length >= 8) {
-				seed64 ^= readBitsCt<uint64_t>(value);
+				seed64 = (seed64 ^ readBitsCt<uint64_t>(value)) * hashMultiplier;
 				value += 8;
 				length -= 8;
 			}
 
 			if (length >= 4) {
-				seed64 ^= readBitsCt<uint32_t>(value);
+				seed64 = (seed64 ^ readBitsCt<uint32_t>(value)) * hashMultiplier;
 				value += 4;
 				length -= 4;
 			}
 
 			if (length >= 2) {
-				seed64 ^= readBitsCt<uint16_t>(value);
+				seed64 = (seed64 ^ readBitsCt<uint16_t>(value)) * hashMultiplier;
 				value += 2;
 				length -= 2;
 			}
 
 			if (length == 1) {
-				seed64 ^= *value;
+				seed64 = (seed64 ^ static_cast<uint8_t>(*value)) * hashMultiplier;
 			}
-			return seed64;
+			return finalizeHash(seed64);
 		}
 	};
 
@@ -177,29 +190,29 @@ namespace jsonifier::internal {
 			uint64_t seed64{ constEval(seed) };
 			while (length >= 8) {
 				std::memcpy(&chunk64, value, 8);
-				seed64 ^= chunk64;
+				seed64 = (seed64 ^ chunk64) * hashMultiplier;
 				value += 8;
 				length -= 8;
 			}
 
 			if (length >= 4) {
 				std::memcpy(&chunk32, value, 4);
-				seed64 ^= chunk32;
+				seed64 = (seed64 ^ chunk32) * hashMultiplier;
 				value += 4;
 				length -= 4;
 			}
 
 			if (length >= 2) {
 				std::memcpy(&chunk16, value, 2);
-				seed64 ^= chunk16;
+				seed64 = (seed64 ^ chunk16) * hashMultiplier;
 				value += 2;
 				length -= 2;
 			}
 
 			if (length == 1) {
-				seed64 ^= *value;
+				seed64 = (seed64 ^ static_cast<uint8_t>(*value)) * hashMultiplier;
 			}
-			return seed64;
+			return finalizeHash(seed64);
 		}
 
 	  protected:
@@ -83,8 +83,12 @@ namespace jsonifier::internal {
 		unique_byte_and_length		= 7,
 		unique_per_length			= 8,
 		simd_full_length			= 9,
+		simd_two_level				= 10,
 	};
 
+	/// @brief Types with more members than this skip the per-byte strategies, whose tables grow with the key alphabet, and go straight to simd_two_level.
+	inline static constexpr size_t wideSchemaThreshold{ 256 };
+
 	inline static constexpr size_t setSimdWidth(size_t length) noexcept {
 		return length >= 64ull && bytesPerStep >= 64ull ? 64ull : length >= 32ull && bytesPerStep >= 32ull ? 32ull : 16ull;
 	}
@@ -126,7 +130,8 @@ namespace jsonifier::internal {
 		using simd_type = map_simd_t<2048>;
 		array<uint16_t, 2048 / setSimdWidth(2048)> bucketSizes{};
 		JSONIFIER_ALIGN(bytesPerStep) array<uint8_t, 2049> controlBytes {};
-		array<uint8_t, 256> uniqueIndices{};
+		array<uint8_t, 2048 / setSimdWidth(2048)> groupShifts{};
+		array<uint16_t, 256> uniqueIndices{};
 		array<uint16_t, 2049> indices{};
 		size_t bucketSize{ setSimdWidth(2048) };
 		size_t numGroups{ 2048 / bucketSize };
@@ -170,7 +175,7 @@ namespace jsonifier::internal {
 		inline static constexpr size_t storageSize{ 256 };
 		constexpr single_byte_data(const hash_map_construction_data& newData) noexcept
 			: uniqueIndices{ newData.uniqueIndices }, uniqueIndex{ newData.uniqueIndex }, type{ newData.type } {};
-		array<uint8_t, 256> uniqueIndices{};
+		array<uint16_t, 256> uniqueIndices{};
 		size_t uniqueIndex{};
 		hash_map_type type{};
 	};
@@ -178,7 +183,7 @@ namespace jsonifier::internal {
 	struct first_byte_and_unique_index_data {
 		inline static constexpr size_t storageSize{ 256 };
 		constexpr first_byte_and_unique_index_data(const hash_map_construction_data& newData) noexcept : uniqueIndices{ newData.uniqueIndices }, type{ newData.type } {};
-		array<uint8_t, 256> uniqueIndices{};
+		array<uint16_t, 256> uniqueIndices{};
 		hash_map_type type{};
 	};
 
@@ -194,7 +199,7 @@ namespace jsonifier::internal {
 	struct unique_per_length_data {
 		inline static constexpr size_t storageSize{ 256 };
 		constexpr unique_per_length_data(const hash_map_construction_data& newData) noexcept : uniqueIndices{ newData.uniqueIndices }, type{ newData.type } {};
-		array<uint8_t, 256> uniqueIndices{};
+		array<uint16_t, 256> uniqueIndices{};
 		hash_map_type type{};
 	};
 
@@ -213,6 +218,22 @@ namespace jsonifier::internal {
 		size_t seed{};
 	};
 
+	/// @brief Full-key hash picks a group, and each group carries its own shift that selects which hash byte serves as its control bytes.
+	/// Choosing the shift per group, rather than one seed for the whole table, is what lets several hundred keys fit without control byte collisions.
+	struct simd_two_level_data {
+		inline static constexpr size_t storageSize{ 2048 };
+		constexpr simd_two_level_data(const hash_map_construction_data& newData) noexcept
+			: controlBytes{ newData.controlBytes }, groupShifts{ newData.groupShifts }, bucketSize{ newData.bucketSize }, numGroups{ newData.numGroups },
+			  indices{ newData.indices }, type{ newData.type }, seed{ newData.hasher.seed } {};
+		JSONIFIER_ALIGN(bytesPerStep) array<uint8_t, storageSize + 1> controlBytes {};
+		array<uint8_t, storageSize / setSimdWidth(storageSize)> groupShifts{};
+		size_t bucketSize{ setSimdWidth(storageSize) };
+		size_t numGroups{ storageSize / bucketSize };
+		array<uint16_t, storageSize + 1> indices{};
+		hash_map_type type{};
+		size_t seed{};
+	};
+
 	struct string_lengths : public tuple_references {
 		size_t length{};
 	};
@@ -333,6 +354,61 @@ namespace jsonifier::internal {
 
 	template<typename value_type> inline static constexpr auto keyStatsVal = keyStatsImpl(tupleReferences<value_type>);
 
+	template<typename value_type> inline static constexpr auto collectSimdTwoLevelHashMapData(const tuple_references& pairsNew) noexcept {
+		hash_map_construction_data returnValues{};
+		if (pairsNew.count >= returnValues.indices.size()) {
+			returnValues.type = hash_map_type::unset;
+			return returnValues;
+		}
+		array<uint64_t, 2048> slotHashes{};
+		for (size_t x = 0; x < 16; ++x) {
+			returnValues.controlBytes.fill(std::numeric_limits<uint8_t>::max());
+			returnValues.indices.fill(static_cast<uint16_t>(returnValues.indices.size() - 1));
+			returnValues.bucketSizes.fill(0);
+			bool collided{};
+			for (size_t y = 0; y < pairsNew.count && !collided; ++y) {
+				const auto hash			 = returnValues.hasher.hashKeyCt(pairsNew.rootPtr[y].key.data(), pairsNew.rootPtr[y].key.size());
+				const auto groupPos		 = hash & (returnValues.numGroups - 1);
+				const auto bucketSizeNew = returnValues.bucketSizes[groupPos]++;
+				if (bucketSizeNew >= returnValues.bucketSize) {
+					collided = true;
+				} else {
+					slotHashes[groupPos * returnValues.bucketSize + bucketSizeNew]			= hash;
+					returnValues.indices[groupPos * returnValues.bucketSize + bucketSizeNew] = pairsNew.rootPtr[y].oldIndex;
+				}
+			}
+			for (size_t y = 0; y < returnValues.numGroups && !collided; ++y) {
+				const size_t groupStart{ y * returnValues.bucketSize };
+				collided = true;
+				for (uint8_t shift = 8; shift <= 56 && collided; ++shift) {
+					array<bool, 256> seen{};
+					collided = false;
+					for (size_t z = 0; z < returnValues.bucketSizes[y]; ++z) {
+						const auto ctrlByte = static_cast<uint8_t>(slotHashes[groupStart + z] >> shift);
+						if (seen[ctrlByte]) {
+							collided = true;
+							break;
+						}
+						seen[ctrlByte] = true;
+					}
+					if (!collided) {
+						returnValues.groupShifts[y] = shift;
+						for (size_t z = 0; z < returnValues.bucketSizes[y]; ++z) {
+							returnValues.controlBytes[groupStart + z] = static_cast<uint8_t>(slotHashes[groupStart + z] >> shift);
+						}
+					}
+				}
+			}
+			if (!collided) {
+				returnValues.type = hash_map_type::simd_two_level;
+				return returnValues;
+			}
+			returnValues.hasher.updateSeed();
+		}
+		returnValues.type = hash_map_type::unset;
+		return returnValues;
+	}
+
 	template<typename value_type> inline static constexpr auto collectSimdFullLengthHashMapData(const tuple_references& pairsNew) noexcept {
 		hash_map_construction_data returnValues{};
 		bool collided{};
@@ -369,9 +445,7 @@ namespace jsonifier::internal {
 			}
 		}
 		if (collided) {
-			returnValues.type		 = hash_map_type::unset;
-			returnValues.uniqueIndex = std::numeric_limits<size_t>::max();
-			return returnValues;
+			return collectSimdTwoLevelHashMapData<value_type>(pairsNew);
 		} else {
 			returnValues.type = hash_map_type::simd_full_length;
 			return returnValues;
@@ -383,13 +457,13 @@ namespace jsonifier::internal {
 		constexpr auto results			 = collectLengths<uniqueLengthCount>(tupleReferences<value_type>);
 		constexpr auto keyStatsValNew	 = keyStats(results);
 		hash_map_construction_data returnValues{};
-		returnValues.uniqueIndices.fill(static_cast<uint8_t>(returnValues.uniqueIndices.size() - 1));
+		returnValues.uniqueIndices.fill(static_cast<uint16_t>(returnValues.uniqueIndices.size() - 1));
 		for (size_t x = 0; x < uniqueLengthCount; ++x) {
 			auto uniqueIndex = findUniqueColumnIndex(results[x], keyStatsValNew[x].minLength);
 			if (uniqueIndex == std::numeric_limits<size_t>::max()) {
 				return collectSimdFullLengthHashMapData<value_type>(pairsNew);
 			} else {
-				returnValues.uniqueIndices[results[x].length] = static_cast<uint8_t>(uniqueIndex);
+				returnValues.uniqueIndices[results[x].length] = static_cast<uint16_t>(uniqueIndex);
 			}
 		}
 		returnValues.type = hash_map_type::unique_per_length;
@@ -430,14 +504,14 @@ namespace jsonifier::internal {
 		constexpr auto results				= collectFirstBytes<uniqueFirstByteCount>(tupleReferencesByFirstByte<value_type>);
 		constexpr auto keyStatsValNew		= keyStats(results);
 		hash_map_construction_data returnValues{};
-		returnValues.uniqueIndices.fill(static_cast<uint8_t>(returnValues.uniqueIndices.size() - 1));
+		returnValues.uniqueIndices.fill(static_cast<uint16_t>(returnValues.uniqueIndices.size() - 1));
 		if (keyStatsValNewer.maxLength < 256) {
 			for (size_t x = 0; x < uniqueFirstByteCount; ++x) {
 				auto uniqueIndex = findUniqueColumnIndex(results[x], keyStatsValNew[x].minLength);
 				if (uniqueIndex == std::numeric_limits<size_t>::max()) {
 					return collectUniqueByteAndLengthHashMapData<value_type>(pairsNew);
 				} else {
-					returnValues.uniqueIndices[static_cast<uint8_t>(results[x].rootPtr[0].key[0])] = static_cast<uint8_t>(uniqueIndex);
+					returnValues.uniqueIndices[static_cast<uint8_t>(results[x].rootPtr[0].key[0])] = static_cast<uint16_t>(uniqueIndex);
 				}
 			}
 		} else {
@@ -452,11 +526,11 @@ namespace jsonifier::internal {
 		hash_map_construction_data returnValues{};
 		returnValues.uniqueIndex = keyStatsVal<value_type>.uniqueIndex;
 		if (returnValues.uniqueIndex != std::numeric_limits<size_t>::max()) {
-			returnValues.uniqueIndices.fill(static_cast<uint8_t>(returnValues.uniqueIndices.size() - 1));
+			returnValues.uniqueIndices.fill(std::numeric_limits<uint16_t>::max());
 			for (size_t x = 0; x < pairsNew.count; ++x) {
 				auto& newRef					 = pairsNew.rootPtr[pairsNew.rootPtr[x].oldIndex];
 				const auto slot					 = static_cast<uint8_t>(newRef.key.data()[returnValues.uniqueIndex]);
-				returnValues.uniqueIndices[slot] = static_cast<uint8_t>(newRef.oldIndex);
+				returnValues.uniqueIndices[slot] = newRef.oldIndex;
 			}
 			returnValues.type = hash_map_type::single_byte;
 			return returnValues;
@@ -526,6 +600,8 @@ namespace jsonifier::internal {
 			hash_map_construction_data returnValues{};
 			returnValues.type = hash_map_type::single_element;
 			return returnValues;
+		} else if constexpr (tupleReferences<value_type>.count > wideSchemaThreshold) {
+			return collectSimdTwoLevelHashMapData<value_type>(tupleReferences<value_type>);
 		} else {
 			if constexpr (keyStatsVal<value_type>.uniqueIndex != std::numeric_limits<size_t>::max()) {
 				if constexpr (tupleReferences<value_type>.count == 2) {
@@ -559,19 +635,21 @@ namespace jsonifier::internal {
 			return unique_per_length_data{ constructionData };
 		} else if constexpr (constructionData.type == hash_map_type::simd_full_length) {
 			return simd_full_length_data{ constructionData };
+		} else if constexpr (constructionData.type == hash_map_type::simd_two_level) {
+			return simd_two_level_data{ constructionData };
 		} else {
 			static_assert(constructionData.type != hash_map_type::unset, "Failed to construct that hashmap!");
 		}
 	}
 
-	template<size_t keyMaxLength> static constexpr auto generateMappingsForLengths(const tuple_references& keys, const array<uint8_t, 256>& uniqueIndices) noexcept {
-		std::array<uint8_t, (keyMaxLength + 1) * 256> mappings{};
-		std::fill(mappings.data(), mappings.data() + mappings.size(), static_cast<uint8_t>(mappings.size() - 1));
+	template<size_t keyMaxLength> static constexpr auto generateMappingsForLengths(const tuple_references& keys, const array<uint16_t, 256>& uniqueIndices) noexcept {
+		std::array<uint16_t, (keyMaxLength + 1) * 256> mappings{};
+		std::fill(mappings.data(), mappings.data() + mappings.size(), std::numeric_limits<uint16_t>::max());
 
 		for (size_t x = 0; x < keys.count; ++x) {
 			const auto& key = keys.rootPtr[x].key;
 
-			uint8_t uniqueIndex = uniqueIndices[key.size()];
+			uint8_t uniqueIndex = static_cast<uint8_t>(uniqueIndices[key.size()]);
 
 			if (uniqueIndex != 255 && uniqueIndex < key.size()) {
 				uint8_t keyChar		= static_cast<uint8_t>(key[uniqueIndex]);
@@ -594,10 +672,10 @@ namespace jsonifier::internal {
 	}
 
 	template<char maxFirstByte, size_t firstCharCount>
-	static constexpr auto generateMappingsForFirstBytes(const array<first_bytes, firstCharCount>& keys, const array<uint8_t, 256>& uniqueIndices) noexcept {
+	static constexpr auto generateMappingsForFirstBytes(const array<first_bytes, firstCharCount>& keys, const array<uint16_t, 256>& uniqueIndices) noexcept {
 		constexpr size_t flattenedSize = (maxFirstByte + 1) * 256ull;
-		std::array<uint8_t, flattenedSize> flattenedMappings{};
-		std::fill(flattenedMappings.data(), flattenedMappings.data() + flattenedMappings.size(), static_cast<uint8_t>(flattenedMappings.size() - 1));
+		std::array<uint16_t, flattenedSize> flattenedMappings{};
+		std::fill(flattenedMappings.data(), flattenedMappings.data() + flattenedMappings.size(), std::numeric_limits<uint16_t>::max());
 
 		for (size_t x = 0; x < firstCharCount; ++x) {
 			const auto& key	   = keys[x].rootPtr[0].key;
@@ -608,7 +686,7 @@ namespace jsonifier::internal {
 				const auto& keyNew = keys[x].rootPtr[y].key;
 				if (uniqueIndex < keyNew.size()) {
 					uint8_t keyChar					= static_cast<uint8_t>(keyNew[uniqueIndex]);
-					size_t flattenedIdx				= static_cast<size_t>(firstByte * maxFirstByte + keyChar);
+					size_t flattenedIdx				= static_cast<size_t>(firstByte) * 256ull + keyChar;
 					flattenedMappings[flattenedIdx] = keys[x].rootPtr[y].oldIndex;
 				}
 			}
@@ -662,10 +740,13 @@ namespace jsonifier::internal {
 				static constexpr auto maxFirstByte{ getMaxFirstByte(firstBytes) };
 				static constexpr auto mappings{ generateMappingsForFirstBytes<maxFirstByte>(firstBytes, hashData<value_type>.uniqueIndices) };
 				const uint8_t firstByte = static_cast<uint8_t>(iter[0]);
-				const uint8_t uniqueIdx = hashData<value_type>.uniqueIndices[firstByte];
+				if JSONIFIER_UNLIKELY (firstByte > static_cast<uint8_t>(maxFirstByte)) {
+					return hashData<value_type>.storageSize;
+				}
+				const uint8_t uniqueIdx = static_cast<uint8_t>(hashData<value_type>.uniqueIndices[firstByte]);
 				if JSONIFIER_LIKELY (checkForEnd(iter, end, uniqueIdx)) {
 					const uint8_t keyChar	  = static_cast<uint8_t>(iter[uniqueIdx]);
-					const size_t flattenedIdx = static_cast<size_t>(firstByte) * static_cast<size_t>(maxFirstByte) + static_cast<size_t>(keyChar);
+					const size_t flattenedIdx = static_cast<size_t>(firstByte) * 256ull + static_cast<size_t>(keyChar);
 					return mappings[flattenedIdx];
 				}
 				return hashData<value_type>.storageSize;
@@ -708,7 +789,26 @@ namespace jsonifier::internal {
 						const uint64_t matches{ simd::opCmpEq(simd::gatherValue<simd_type>(static_cast<uint8_t>(hash)),
 							simd::gatherValues<simd_type>(ctrlBytesPtr + resultIndex)) };
 						const size_t tz = simd::postCmpTzcnt(matches);
-						return hashData<value_type>.indices[resultIndex + tz];
+						return tz < hashData<value_type>.bucketSize ? hashData<value_type>.indices[resultIndex + tz] : hashData<value_type>.storageSize;
+					}
+				}
+				return hashData<value_type>.storageSize;
+			} else if constexpr (hashData<value_type>.type == hash_map_type::simd_two_level) {
+				using simd_type = map_simd_t<hashData<value_type>.storageSize>;
+				static constexpr rt_key_hasher<hashData<value_type>.seed> hasher{};
+				static constexpr auto groupMask{ hashData<value_type>.numGroups - 1u };
+				static constexpr auto ctrlBytesPtr{ hashData<value_type>.controlBytes.data() };
+				const auto newPtr = char_comparison<'"', jsonifier::internal::remove_cvref_t<decltype(*iter)>>::memchar(iter + subAmount01, subAmount02);
+				if JSONIFIER_LIKELY (newPtr) {
+					const size_t length = static_cast<size_t>(newPtr - iter);
+					if JSONIFIER_LIKELY (checkForEnd(iter, end, length)) {
+						const auto hash			 = hasher.hashKeyRt(iter, length);
+						const size_t group		 = hash & groupMask;
+						const size_t resultIndex = group * hashData<value_type>.bucketSize;
+						const uint64_t matches{ simd::opCmpEq(simd::gatherValue<simd_type>(static_cast<uint8_t>(hash >> hashData<value_type>.groupShifts[group])),
+							simd::gatherValues<simd_type>(ctrlBytesPtr + resultIndex)) };
+						const size_t tz = simd::postCmpTzcnt(matches);
+						return tz < hashData<value_type>.bucketSize ? hashData<value_type>.indices[resultIndex + tz] : hashData<value_type>.storageSize;
 					}
 				}
 				return hashData<value_type>.storageSize;
@@ -0,0 +1,180 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/PaddedString.hpp>
+#include <string>
+
+#if JSONIFIER_PLATFORM_LINUX || JSONIFIER_PLATFORM_MAC
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#else
+	#include <cstdio>
+#endif
+
+namespace jsonifier {
+
+	/// @brief A file's contents, mapped read-only rather than read, followed by paddingBytes of whitespace so they parse as a padded_view.
+	/// The mapping is private: the file's pages are shared with the page cache, and only the page holding the end of the file is copied, when the
+	/// padding is written into the slack behind it. An anonymous page reserved past the file covers padding that does not fit in that slack.
+	/// Where mmap is unavailable the file is read into a padded_string instead.
+	class mapped_file {
+	  public:
+		using size_type = uint64_t;
+
+		JSONIFIER_INLINE mapped_file() noexcept = default;
+
+		JSONIFIER_INLINE explicit mapped_file(string_view path) noexcept {
+			open(path);
+		}
+
+		mapped_file& operator=(const mapped_file&) = delete;
+		mapped_file(const mapped_file&)			   = delete;
+
+		JSONIFIER_INLINE mapped_file& operator=(mapped_file&& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				close();
+				std::swap(dataVal, other.dataVal);
+				std::swap(sizeVal, other.sizeVal);
+				std::swap(mappedSize, other.mappedSize);
+				std::swap(fallback, other.fallback);
+			}
+			return *this;
+		}
+
+		JSONIFIER_INLINE mapped_file(mapped_file&& other) noexcept {
+			*this = internal::move(other);
+		}
+
+		/// @brief Maps the file at path, replacing whatever was mapped before. Returns false, leaving nothing mapped, if it cannot be opened or read.
+		JSONIFIER_INLINE bool open(string_view path) noexcept {
+			close();
+			const std::string pathNew{ path.data(), path.size() };
+#if JSONIFIER_PLATFORM_LINUX || JSONIFIER_PLATFORM_MAC
+			const int fileDescriptor{ ::open(pathNew.c_str(), O_RDONLY | O_CLOEXEC) };
+			if JSONIFIER_UNLIKELY (fileDescriptor < 0) {
+				return false;
+			}
+			struct stat fileStat {};
+			if JSONIFIER_UNLIKELY (::fstat(fileDescriptor, &fileStat) != 0) {
+				::close(fileDescriptor);
+				return false;
+			}
+			const size_type fileSize{ static_cast<size_type>(fileStat.st_size) };
+			const size_type pageSize{ static_cast<size_type>(::sysconf(_SC_PAGESIZE)) };
+			const size_type mappedSizeNew{ (fileSize + paddingBytes + pageSize - 1) / pageSize * pageSize };
+			void* base{ ::mmap(nullptr, mappedSizeNew, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+			if JSONIFIER_UNLIKELY (base == MAP_FAILED) {
+				::close(fileDescriptor);
+				return false;
+			}
+			if (fileSize > 0) {
+				if JSONIFIER_UNLIKELY (::mmap(base, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fileDescriptor, 0) == MAP_FAILED) {
+					::munmap(base, mappedSizeNew);
+					::close(fileDescriptor);
+					return false;
+				}
+				::madvise(base, fileSize, MADV_SEQUENTIAL);
+	#if defined(MADV_HUGEPAGE)
+				::madvise(base, fileSize, MADV_HUGEPAGE);
+	#endif
+			}
+			::close(fileDescriptor);
+			dataVal	   = static_cast<char*>(base);
+			sizeVal	   = fileSize;
+			mappedSize = mappedSizeNew;
+			std::memset(dataVal + sizeVal, ' ', paddingBytes);
+			::mprotect(base, mappedSize, PROT_READ);
+			return true;
+#else
+			std::FILE* file{ std::fopen(pathNew.c_str(), "rb") };
+			if JSONIFIER_UNLIKELY (!file) {
+				return false;
+			}
+			bool result{ std::fseek(file, 0, SEEK_END) == 0 };
+			const long fileSize{ result ? std::ftell(file) : -1 };
+			result = fileSize >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+			if JSONIFIER_LIKELY (result) {
+				fallback.resize(static_cast<size_type>(fileSize));
+				result = std::fread(fallback.data(), 1, fallback.size(), file) == fallback.size();
+			}
+			std::fclose(file);
+			if JSONIFIER_UNLIKELY (!result) {
+				fallback = padded_string{};
+				return false;
+			}
+			dataVal = fallback.data();
+			sizeVal = fallback.size();
+			return true;
+#endif
+		}
+
+		JSONIFIER_INLINE const char* data() const noexcept {
+			return dataVal;
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		JSONIFIER_INLINE bool isOpen() const noexcept {
+			return dataVal != nullptr;
+		}
+
+		JSONIFIER_INLINE explicit operator bool() const noexcept {
+			return isOpen();
+		}
+
+		JSONIFIER_INLINE padded_view view() const noexcept {
+			return padded_view{ dataVal, sizeVal };
+		}
+
+		JSONIFIER_INLINE void close() noexcept {
+#if JSONIFIER_PLATFORM_LINUX || JSONIFIER_PLATFORM_MAC
+			if (mappedSize > 0) {
+				::munmap(dataVal, mappedSize);
+			}
+#endif
+			fallback   = padded_string{};
+			dataVal	   = nullptr;
+			sizeVal	   = 0;
+			mappedSize = 0;
+		}
+
+		JSONIFIER_INLINE ~mapped_file() noexcept {
+			close();
+		}
+
+	  protected:
+		char* dataVal{};
+		size_type sizeVal{};
+		size_type mappedSize{};
+		padded_string fallback{};
+	};
+
+}
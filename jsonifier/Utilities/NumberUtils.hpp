@@ -33,7 +33,7 @@
 
 namespace jsonifier {
 
-	template<bool> class jsonifier_core;
+	template<bool, typename> class jsonifier_core;
 
 	template<typename value_type_new = char, concepts::num_t value_type01> JSONIFIER_INLINE static string_base<value_type_new> toString(const value_type01& value) noexcept {
 		string_base<value_type_new> returnstring{};
@@ -144,4 +144,46 @@ namespace jsonifier::internal {
 			}
 		}
 	}
+
+	/// @brief Swar path for plain integers of up to sixteen digits, anything else (leading zeros, fractions, exponents, short tails) goes through parseNumber.
+	template<concepts::integer_t value_type, typename iterator> JSONIFIER_INLINE static bool parseIntegerSwar(value_type& value, iterator&& iter, iterator&& end) noexcept {
+		static constexpr uint64_t asciiZeros{ 0x3030303030303030ull };
+		static constexpr uint64_t digitCeiling{ 0x4646464646464646ull };
+		static constexpr uint64_t highBits{ 0x8080808080808080ull };
+		const bool negative{ *iter == minus };
+		if constexpr (concepts::unsigned_t<value_type>) {
+			if JSONIFIER_UNLIKELY (negative) {
+				return parseNumber(value, iter, end);
+			}
+		}
+		string_view_ptr newIter{ iter + negative };
+		if JSONIFIER_UNLIKELY (end - newIter < 16 || *newIter == zero) {
+			return parseNumber(value, iter, end);
+		}
+		uint64_t word{ jsonifier_fast_float::read8_to_u64(newIter) };
+		uint64_t nonDigits{ ((word + digitCeiling) | (word - asciiZeros)) & highBits };
+		uint64_t digitCount{ nonDigits ? (simd::tzcnt(nonDigits) >> 3) : 8 };
+		if JSONIFIER_UNLIKELY (digitCount == 0) {
+			return parseNumber(value, iter, end);
+		}
+		uint64_t result{ jsonifier_fast_float::parse_eight_digits_unrolled_no_sub((word - asciiZeros) << (64 - (digitCount << 3))) };
+		if (digitCount == 8) {
+			word				   = jsonifier_fast_float::read8_to_u64(newIter + 8);
+			nonDigits			   = ((word + digitCeiling) | (word - asciiZeros)) & highBits;
+			const uint64_t tailCount{ nonDigits ? (simd::tzcnt(nonDigits) >> 3) : 8 };
+			if JSONIFIER_UNLIKELY (tailCount == 8) {
+				return parseNumber(value, iter, end);
+			}
+			if (tailCount > 0) {
+				result = result * pow_tables<>::powerOfTenUint[tailCount] + jsonifier_fast_float::parse_eight_digits_unrolled_no_sub((word - asciiZeros) << (64 - (tailCount << 3)));
+			}
+			digitCount += tailCount;
+		}
+		if JSONIFIER_UNLIKELY (exp_tables<>::expFracTable[static_cast<uint8_t>(newIter[digitCount])]) {
+			return parseNumber(value, iter, end);
+		}
+		value = negative ? static_cast<value_type>(-static_cast<int64_t>(result)) : static_cast<value_type>(result);
+		iter  = newIter + digitCount;
+		return true;
+	}
 }
\ No newline at end of file
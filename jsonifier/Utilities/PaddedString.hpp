@@ -0,0 +1,166 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/StringView.hpp>
+
+namespace jsonifier {
+
+	/// @brief Readable bytes that padded input carries past its end: one whole stage-1 block, so the last block can be indexed in place and every
+	/// fixed-width peek the parser makes near the end stays inside the buffer.
+	inline constexpr uint64_t paddingBytes{ bitsPerStep };
+
+	/// @brief A view of json text followed by at least paddingBytes readable bytes of whitespace. Parsing one turns on parse_options::paddedInput.
+	class padded_view : public string_view {
+	  public:
+		JSONIFIER_INLINE constexpr padded_view() noexcept = default;
+
+		/// @brief The caller guarantees that the paddingBytes bytes following dataNew + sizeNew are readable and hold only whitespace.
+		JSONIFIER_INLINE constexpr padded_view(const_pointer dataNew, size_type sizeNew) noexcept : string_view{ dataNew, sizeNew } {}
+	};
+
+	/// @brief Owning json text with paddingBytes bytes of whitespace kept behind its end, so it can always be parsed as a padded_view.
+	class padded_string : protected internal::alloc_wrapper<char> {
+	  public:
+		using value_type	= char;
+		using pointer		= char*;
+		using const_pointer = const char*;
+		using size_type		= uint64_t;
+		using allocator		= internal::alloc_wrapper<char>;
+
+		JSONIFIER_INLINE padded_string() noexcept = default;
+
+		JSONIFIER_INLINE explicit padded_string(size_type sizeNew) noexcept {
+			resize(sizeNew);
+		}
+
+		JSONIFIER_INLINE padded_string(const_pointer dataNew, size_type sizeNew) noexcept {
+			resize(sizeNew);
+			std::memcpy(dataVal, dataNew, sizeNew);
+		}
+
+		template<concepts::has_data value_type_new> JSONIFIER_INLINE explicit padded_string(const value_type_new& other) noexcept
+			: padded_string{ other.data(), static_cast<size_type>(other.size()) } {}
+
+		JSONIFIER_INLINE padded_string(const padded_string& other) noexcept : padded_string{ other.data(), other.size() } {}
+
+		JSONIFIER_INLINE padded_string& operator=(const padded_string& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				resize(other.size());
+				std::memcpy(dataVal, other.data(), other.size());
+			}
+			return *this;
+		}
+
+		JSONIFIER_INLINE padded_string(padded_string&& other) noexcept {
+			std::swap(dataVal, other.dataVal);
+			std::swap(sizeVal, other.sizeVal);
+			std::swap(capacityVal, other.capacityVal);
+		}
+
+		JSONIFIER_INLINE padded_string& operator=(padded_string&& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				reset();
+				std::swap(dataVal, other.dataVal);
+				std::swap(sizeVal, other.sizeVal);
+				std::swap(capacityVal, other.capacityVal);
+			}
+			return *this;
+		}
+
+		/// @brief Sets the size to sizeNew, keeping the first min(size(), sizeNew) bytes and leaving any new ones unwritten for the caller to fill,
+		/// such as with a socket read straight into data(). The padding behind the new end is rewritten.
+		JSONIFIER_INLINE void resize(size_type sizeNew) noexcept {
+			if (sizeNew > capacityVal || !dataVal) {
+				const size_type capacityNew{ sizeNew > capacityVal * 2 ? sizeNew : capacityVal * 2 };
+				pointer newPtr{ allocator::allocate(capacityNew + paddingBytes) };
+				if (sizeVal > 0) {
+					std::memcpy(newPtr, dataVal, sizeVal);
+				}
+				reset();
+				dataVal		= newPtr;
+				capacityVal = capacityNew;
+			}
+			sizeVal = sizeNew;
+			std::memset(dataVal + sizeVal, ' ', paddingBytes);
+		}
+
+		JSONIFIER_INLINE pointer data() noexcept {
+			return dataVal;
+		}
+
+		JSONIFIER_INLINE const_pointer data() const noexcept {
+			return dataVal;
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		JSONIFIER_INLINE size_type capacity() const noexcept {
+			return capacityVal;
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return sizeVal == 0;
+		}
+
+		JSONIFIER_INLINE padded_view view() const noexcept {
+			return padded_view{ dataVal, sizeVal };
+		}
+
+		JSONIFIER_INLINE operator padded_view() const noexcept {
+			return view();
+		}
+
+		JSONIFIER_INLINE ~padded_string() noexcept {
+			reset();
+		}
+
+	  protected:
+		pointer dataVal{};
+		size_type sizeVal{};
+		size_type capacityVal{};
+
+		JSONIFIER_INLINE void reset() noexcept {
+			if (dataVal) {
+				allocator::deallocate(dataVal, capacityVal + paddingBytes);
+				dataVal		= nullptr;
+				sizeVal		= 0;
+				capacityVal = 0;
+			}
+		}
+	};
+
+	namespace concepts {
+
+		template<typename value_type>
+		concept padded_input_t = std::is_base_of_v<padded_view, jsonifier::internal::remove_cvref_t<value_type>> ||
+			std::is_same_v<padded_string, jsonifier::internal::remove_cvref_t<value_type>>;
+
+	}
+
+}
@@ -23,8 +23,11 @@
 /// Feb 20, 2023
 #pragma once
 
-#include <jsonifier/Utilities/HashMap.hpp>
+#include <jsonifier/Utilities/StringUtils.hpp>
 #include <jsonifier/Utilities/String.hpp>
+#include <jsonifier/Utilities/Simd.hpp>
+#include <memory>
+#include <mutex>
 
 namespace jsonifier {
 
@@ -33,18 +36,33 @@ namespace jsonifier {
 	struct json_number {
 		JSONIFIER_INLINE json_number() noexcept = default;
 
-		JSONIFIER_INLINE json_number(const string& stringNew) noexcept : rawJson{ stringNew } {};
+		JSONIFIER_INLINE json_number(string_view stringNew) noexcept : rawJson{ stringNew } {};
 
 		JSONIFIER_INLINE uint64_t getUint() const {
-			return strToUint64(rawJson);
+			uint64_t newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				auto iter = static_cast<string_view_ptr>(rawJson.data());
+				internal::integer_parser<uint64_t>::parseInt(newValue, iter, iter + rawJson.size());
+			}
+			return newValue;
 		}
 
 		JSONIFIER_INLINE int64_t getInt() const {
-			return strToInt64(rawJson);
+			int64_t newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				auto iter = static_cast<string_view_ptr>(rawJson.data());
+				internal::integer_parser<int64_t>::parseInt(newValue, iter, iter + rawJson.size());
+			}
+			return newValue;
 		}
 
 		JSONIFIER_INLINE double getDouble() const {
-			return strToDouble(rawJson);
+			double newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				auto iter = static_cast<string_view_ptr>(rawJson.data());
+				internal::parseFloat(newValue, iter, iter + rawJson.size());
+			}
+			return newValue;
 		}
 
 		JSONIFIER_INLINE friend bool operator!=(const json_number& lhs, const json_number& rhs) {
@@ -58,246 +76,449 @@ namespace jsonifier {
 		string_view rawJson{};
 	};
 
-	class raw_json_data {
-	  public:
-		using object_type = std::unordered_map<string, raw_json_data>;
-		using string_type = string;
-		using array_type  = std::vector<raw_json_data>;
-		using number_type = json_number;
-		using bool_type	  = bool;
-		using null_type	  = std::nullptr_t;
-		using error_type  = std::monostate;
-		using value_type  = std::variant<object_type, array_type, string_type, number_type, bool_type, null_type, error_type>;
+}
 
-		JSONIFIER_INLINE raw_json_data() noexcept {
-			value = null_type{};
-		}
+namespace jsonifier::internal {
 
-		template<typename parser_type> JSONIFIER_INLINE raw_json_data(parser_type& parser, const string& jsonDataNew) noexcept {
-			value	 = constructValueFromRawJsonData(parser, jsonDataNew);
-			jsonData = jsonDataNew;
+	inline constexpr array<json_type, 256> rawJsonTypes{ []() constexpr {
+		array<json_type, 256> returnValues{};
+		for (uint64_t x = 0; x < 256; ++x) {
+			returnValues[x] = json_type::unset;
 		}
+		returnValues['{'] = json_type::object;
+		returnValues['['] = json_type::array;
+		returnValues['"'] = json_type::string;
+		returnValues['t'] = json_type::boolean;
+		returnValues['f'] = json_type::boolean;
+		returnValues['n'] = json_type::null;
+		returnValues['-'] = json_type::number;
+		for (uint64_t x = '0'; x <= '9'; ++x) {
+			returnValues[x] = json_type::number;
+		}
+		return returnValues;
+	}() };
+
+	/// @brief One value of a raw_json_data document. Scalars and containers alike are a byte range of the captured source, so the type is
+	/// recovered from the first byte and no payload is copied.
+	struct raw_json_entry {
+		uint64_t offset{};
+		uint32_t length{};
+		/// @brief Index of the first entry past this value's subtree, which is how siblings are skipped without visiting their children.
+		uint32_t next{};
+	};
 
-		JSONIFIER_INLINE json_type getType() const noexcept {
-			if (std::holds_alternative<object_type>(value)) {
-				return json_type::object;
-			} else if (std::holds_alternative<array_type>(value)) {
-				return json_type::array;
-			} else if (std::holds_alternative<string_type>(value)) {
-				return json_type::string;
-			} else if (std::holds_alternative<number_type>(value)) {
-				return json_type::number;
-			} else if (std::holds_alternative<bool_type>(value)) {
-				return json_type::boolean;
-			} else if (std::holds_alternative<null_type>(value)) {
-				return json_type::null;
-			} else {
-				return json_type::unset;
+	/// @brief A captured json value and its flat tape: entries are in document order, and an object's children alternate between key and value.
+	/// Capturing only copies the bytes; the tape is built on the first structural access, so values that are merely re-serialized are never indexed.
+	class raw_json_document {
+	  public:
+		JSONIFIER_INLINE raw_json_document(string_view jsonDataNew) noexcept {
+			uint64_t newSize{ jsonDataNew.size() };
+			while (newSize > 0 && whitespaceTable[static_cast<uint8_t>(jsonDataNew[newSize - 1])]) {
+				--newSize;
 			}
+			source = string{ jsonDataNew.data(), newSize };
 		}
 
-		JSONIFIER_INLINE const object_type& getObject() const noexcept {
-			return std::get<object_type>(value);
+		JSONIFIER_INLINE string_view getSource() const noexcept {
+			return { source.data(), source.size() };
 		}
 
-		JSONIFIER_INLINE object_type& getObject() noexcept {
-			return std::get<object_type>(value);
+		JSONIFIER_INLINE const std::vector<raw_json_entry>& getEntries() const noexcept {
+			std::call_once(tapeFlag, [this] {
+				buildTape();
+			});
+			return entries;
 		}
 
-		JSONIFIER_INLINE const array_type& getArray() const noexcept {
-			return std::get<array_type>(value);
+		JSONIFIER_INLINE string_view getValue(uint32_t index) const noexcept {
+			const auto& entry = getEntries()[index];
+			return { source.data() + entry.offset, entry.length };
 		}
 
-		JSONIFIER_INLINE array_type& getArray() noexcept {
-			return std::get<array_type>(value);
+		JSONIFIER_INLINE json_type getType(uint32_t index) const noexcept {
+			return rawJsonTypes[static_cast<uint8_t>(source[getEntries()[index].offset])];
 		}
 
-		JSONIFIER_INLINE const string_type& getString() const noexcept {
-			return std::get<string_type>(value);
+	  protected:
+		enum class tape_state : uint8_t { value, value_or_close, key, key_or_close, colon, comma_or_close, done };
+
+		mutable std::vector<raw_json_entry> entries{};
+		mutable std::once_flag tapeFlag{};
+		string source{};
+
+		/// @brief Walks the structural indices once, pushing an entry per value and patching each container's length and next index when it closes.
+		/// Any structural mismatch, or a tape that cannot be allocated, leaves the tape empty, which getType() reports as json_type::unset.
+		JSONIFIER_INLINE void buildTape() const noexcept {
+			if JSONIFIER_UNLIKELY (source.size() == 0 || source.size() > std::numeric_limits<uint32_t>::max()) {
+				return;
+			}
+			simd_string_reader<false> section{};
+			section.template reset<false>(source.data(), source.size());
+			string_view_ptr* iter = section.begin();
+			if JSONIFIER_UNLIKELY (!iter) {
+				return failTape();
+			}
+			string_view_ptr* endIter = section.end();
+			const string_view_ptr rootIter{ source.data() };
+			std::vector<uint32_t> openContainers{};
+			tape_state state{ tape_state::value };
+			entries.reserve(static_cast<size_t>(endIter - iter));
+			for (; iter < endIter; ++iter) {
+				const char currentChar{ **iter };
+				const bool insideObject{ !openContainers.empty() && rootIter[entries[openContainers.back()].offset] == '{' };
+				switch (currentChar) {
+					case '{':
+						[[fallthrough]];
+					case '[': {
+						if JSONIFIER_UNLIKELY (state != tape_state::value && state != tape_state::value_or_close) {
+							return failTape();
+						}
+						openContainers.emplace_back(static_cast<uint32_t>(entries.size()));
+						entries.emplace_back(raw_json_entry{ static_cast<uint64_t>(*iter - rootIter) });
+						state = currentChar == '{' ? tape_state::key_or_close : tape_state::value_or_close;
+						break;
+					}
+					case '}':
+						[[fallthrough]];
+					case ']': {
+						const bool matches{ !openContainers.empty() && insideObject == (currentChar == '}') };
+						const bool closable{ state == tape_state::comma_or_close || state == tape_state::key_or_close || state == tape_state::value_or_close };
+						if JSONIFIER_UNLIKELY (!matches || !closable) {
+							return failTape();
+						}
+						auto& entry	 = entries[openContainers.back()];
+						entry.length = static_cast<uint32_t>(*iter + 1 - rootIter - static_cast<int64_t>(entry.offset));
+						entry.next	 = static_cast<uint32_t>(entries.size());
+						openContainers.pop_back();
+						state = openContainers.empty() ? tape_state::done : tape_state::comma_or_close;
+						break;
+					}
+					case ':': {
+						if JSONIFIER_UNLIKELY (state != tape_state::colon) {
+							return failTape();
+						}
+						state = tape_state::value;
+						break;
+					}
+					case ',': {
+						if JSONIFIER_UNLIKELY (state != tape_state::comma_or_close) {
+							return failTape();
+						}
+						state = insideObject ? tape_state::key : tape_state::value;
+						break;
+					}
+					default: {
+						const bool isKey{ state == tape_state::key || state == tape_state::key_or_close };
+						if JSONIFIER_UNLIKELY ((!isKey && state != tape_state::value && state != tape_state::value_or_close) || (isKey && currentChar != '"')) {
+							return failTape();
+						}
+						string_view_ptr valueEnd{ iter[1] };
+						while (valueEnd > *iter && whitespaceTable[static_cast<uint8_t>(valueEnd[-1])]) {
+							--valueEnd;
+						}
+						if JSONIFIER_UNLIKELY (!validateScalar(*iter, valueEnd)) {
+							return failTape();
+						}
+						entries.emplace_back(
+							raw_json_entry{ static_cast<uint64_t>(*iter - rootIter), static_cast<uint32_t>(valueEnd - *iter), static_cast<uint32_t>(entries.size() + 1) });
+						state = isKey ? tape_state::colon : (openContainers.empty() ? tape_state::done : tape_state::comma_or_close);
+						break;
+					}
+				}
+			}
+			if JSONIFIER_UNLIKELY (state != tape_state::done) {
+				return failTape();
+			}
 		}
 
-		JSONIFIER_INLINE string_type& getString() noexcept {
-			return std::get<string_type>(value);
+		JSONIFIER_INLINE static bool validateScalar(string_view_ptr start, string_view_ptr end) noexcept {
+			const uint64_t length{ static_cast<uint64_t>(end - start) };
+			switch (rawJsonTypes[static_cast<uint8_t>(*start)]) {
+				case json_type::string: {
+					return length >= 2 && end[-1] == '"';
+				}
+				case json_type::boolean: {
+					return (length == 4 || length == 5) && length == 4u + (*start == 'f') && validateBool(start);
+				}
+				case json_type::null: {
+					return length == 4 && validateNull(start);
+				}
+				case json_type::number: {
+					return true;
+				}
+				default: {
+					return false;
+				}
+			}
 		}
 
-		JSONIFIER_INLINE const number_type& getNumber() const noexcept {
-			return std::get<number_type>(value);
+		JSONIFIER_INLINE void failTape() const noexcept {
+			entries.clear();
 		}
+	};
+
+}
+
+namespace jsonifier {
+
+	/// @brief A read-only json value backed by a flat tape over its own copy of the source text.
+	/// Children are handles into the same shared document, so copies and lookups never allocate per value, and rawJson() on a
+	/// freshly parsed value returns the captured bytes without building the tape at all.
+	class raw_json_data {
+	  public:
+		using string_type = string;
+		using number_type = json_number;
+		using bool_type	  = bool;
+		using null_type	  = std::nullptr_t;
+
+		class array_type {
+		  public:
+			class iterator {
+			  public:
+				using value_type		= raw_json_data;
+				using difference_type	= std::ptrdiff_t;
+				using iterator_category = std::forward_iterator_tag;
+
+				JSONIFIER_INLINE iterator() noexcept = default;
+
+				JSONIFIER_INLINE iterator(const raw_json_data* parentNew, uint32_t indexNew) noexcept : parent{ parentNew }, index{ indexNew } {};
+
+				JSONIFIER_INLINE raw_json_data operator*() const noexcept {
+					return { parent->document, index };
+				}
+
+				JSONIFIER_INLINE iterator& operator++() noexcept {
+					index = parent->document->getEntries()[index].next;
+					return *this;
+				}
+
+				JSONIFIER_INLINE iterator operator++(int32_t) noexcept {
+					iterator temp{ *this };
+					++*this;
+					return temp;
+				}
+
+				JSONIFIER_INLINE bool operator==(const iterator& other) const noexcept {
+					return index == other.index;
+				}
+
+			  protected:
+				const raw_json_data* parent{};
+				uint32_t index{};
+			};
+
+			JSONIFIER_INLINE array_type(const raw_json_data* parentNew) noexcept : parent{ parentNew } {};
+
+			JSONIFIER_INLINE iterator begin() const noexcept {
+				return parent->getType() == json_type::array ? iterator{ parent, parent->index + 1 } : end();
+			}
+
+			JSONIFIER_INLINE iterator end() const noexcept {
+				return parent->getType() == json_type::array ? iterator{ parent, parent->document->getEntries()[parent->index].next } : iterator{};
+			}
+
+			JSONIFIER_INLINE size_t size() const noexcept {
+				return static_cast<size_t>(std::distance(begin(), end()));
+			}
+
+		  protected:
+			const raw_json_data* parent{};
+		};
+
+		class object_type {
+		  public:
+			class iterator {
+			  public:
+				using value_type		= std::pair<string_view, raw_json_data>;
+				using difference_type	= std::ptrdiff_t;
+				using iterator_category = std::forward_iterator_tag;
+
+				JSONIFIER_INLINE iterator() noexcept = default;
 
-		JSONIFIER_INLINE number_type& getNumber() noexcept {
-			return std::get<number_type>(value);
+				JSONIFIER_INLINE iterator(const raw_json_data* parentNew, uint32_t indexNew) noexcept : parent{ parentNew }, index{ indexNew } {};
+
+				JSONIFIER_INLINE value_type operator*() const noexcept {
+					const auto key = parent->document->getValue(index);
+					return { string_view{ key.data() + 1, key.size() - 2 }, raw_json_data{ parent->document, index + 1 } };
+				}
+
+				JSONIFIER_INLINE iterator& operator++() noexcept {
+					index = parent->document->getEntries()[index + 1].next;
+					return *this;
+				}
+
+				JSONIFIER_INLINE iterator operator++(int32_t) noexcept {
+					iterator temp{ *this };
+					++*this;
+					return temp;
+				}
+
+				JSONIFIER_INLINE bool operator==(const iterator& other) const noexcept {
+					return index == other.index;
+				}
+
+				JSONIFIER_INLINE uint32_t getIndex() const noexcept {
+					return index;
+				}
+
+			  protected:
+				const raw_json_data* parent{};
+				uint32_t index{};
+			};
+
+			JSONIFIER_INLINE object_type(const raw_json_data* parentNew) noexcept : parent{ parentNew } {};
+
+			JSONIFIER_INLINE iterator begin() const noexcept {
+				return parent->getType() == json_type::object ? iterator{ parent, parent->index + 1 } : end();
+			}
+
+			JSONIFIER_INLINE iterator end() const noexcept {
+				return parent->getType() == json_type::object ? iterator{ parent, parent->document->getEntries()[parent->index].next } : iterator{};
+			}
+
+			JSONIFIER_INLINE size_t size() const noexcept {
+				return static_cast<size_t>(std::distance(begin(), end()));
+			}
+
+			/// @brief Linear scan over the member keys, compared in their raw (still escaped) form.
+			template<std::convertible_to<string_view> key_type> JSONIFIER_INLINE iterator find(key_type&& key) const noexcept {
+				const string_view keyNew{ key };
+				const auto endIter = end();
+				for (auto iter = begin(); iter != endIter; ++iter) {
+					const auto currentKey = parent->document->getValue(iter.getIndex());
+					if (currentKey.size() == keyNew.size() + 2 && string_view{ currentKey.data() + 1, keyNew.size() } == keyNew) {
+						return iter;
+					}
+				}
+				return endIter;
+			}
+
+		  protected:
+			const raw_json_data* parent{};
+		};
+
+		JSONIFIER_INLINE raw_json_data() noexcept = default;
+
+		JSONIFIER_INLINE explicit raw_json_data(string_view jsonDataNew) noexcept : document{ std::make_shared<internal::raw_json_document>(jsonDataNew) } {};
+
+		JSONIFIER_INLINE json_type getType() const noexcept {
+			if (!document || document->getSource().size() == 0) {
+				return json_type::null;
+			} else if JSONIFIER_UNLIKELY (document->getEntries().empty()) {
+				return json_type::unset;
+			} else {
+				return document->getType(index);
+			}
 		}
 
-		JSONIFIER_INLINE double getDouble() const noexcept {
-			return std::get<number_type>(value).getDouble();
+		JSONIFIER_INLINE object_type getObject() const noexcept {
+			return { this };
 		}
 
-		JSONIFIER_INLINE int64_t getInt() const noexcept {
-			return std::get<number_type>(value).getInt();
+		JSONIFIER_INLINE array_type getArray() const noexcept {
+			return { this };
 		}
 
-		JSONIFIER_INLINE uint64_t getUint() const noexcept {
-			return std::get<number_type>(value).getUint();
+		/// @brief Unescapes the string on each call, an empty string is returned for non-string values or invalid escapes.
+		JSONIFIER_INLINE string_type getString() const noexcept {
+			static constexpr parse_options optionsNew{};
+			string_type returnValue{};
+			if (getType() == json_type::string) {
+				const auto rawString = document->getValue(index);
+				internal::resizeUninitialized(returnValue, rawString.size() + bytesPerStep);
+				auto iter		  = static_cast<string_view_ptr>(rawString.data()) + 1;
+				const auto newPtr = internal::string_parser<optionsNew, string_view_ptr, char*>::impl(iter, returnValue.data(), rawString.size() - 1);
+				returnValue.resize(newPtr ? static_cast<size_t>(newPtr - returnValue.data()) : 0);
+			}
+			return returnValue;
 		}
 
-		JSONIFIER_INLINE const bool_type& getBool() const noexcept {
-			return std::get<bool_type>(value);
+		JSONIFIER_INLINE number_type getNumber() const noexcept {
+			return getType() == json_type::number ? number_type{ rawJson() } : number_type{};
 		}
 
-		JSONIFIER_INLINE bool_type& getBool() noexcept {
-			return std::get<bool_type>(value);
+		JSONIFIER_INLINE double getDouble() const noexcept {
+			return getNumber().getDouble();
 		}
 
-		template<std::integral index_type> JSONIFIER_INLINE raw_json_data& operator[](index_type&& index) noexcept {
-			return (std::get<array_type>(value))[index];
+		JSONIFIER_INLINE int64_t getInt() const noexcept {
+			return getNumber().getInt();
 		}
 
-		template<std::integral index_type> JSONIFIER_INLINE const raw_json_data& operator[](index_type&& index) const noexcept {
-			return (std::get<array_type>(value))[index];
+		JSONIFIER_INLINE uint64_t getUint() const noexcept {
+			return getNumber().getUint();
 		}
 
-		template<std::convertible_to<string_view> key_type> JSONIFIER_INLINE raw_json_data& operator[](key_type&& key) noexcept {
-			if (std::holds_alternative<null_type>(value)) {
-				value = object_type{};
+		JSONIFIER_INLINE bool_type getBool() const noexcept {
+			return getType() == json_type::boolean && rawJson()[0] == 't';
+		}
+
+		/// @brief Out of range indices and non-array values yield a default (null) value.
+		template<std::integral index_type> JSONIFIER_INLINE raw_json_data operator[](index_type indexNew) const noexcept {
+			if constexpr (std::is_signed_v<index_type>) {
+				if JSONIFIER_UNLIKELY (indexNew < 0) {
+					return raw_json_data{};
+				}
+			}
+			const auto array = getArray();
+			auto iter		 = array.begin();
+			const auto end	 = array.end();
+			for (; iter != end && indexNew > 0; --indexNew) {
+				++iter;
 			}
-			auto& object = std::get<object_type>(value);
-			return object[key];
+			return iter != end ? *iter : raw_json_data{};
 		}
 
-		template<std::convertible_to<const string_view> key_type> JSONIFIER_INLINE const raw_json_data& operator[](key_type&& key) const noexcept {
-			const auto& object = std::get<object_type>(value);
-			return object.at(key);
+		/// @brief Missing keys and non-object values yield a default (null) value.
+		template<std::convertible_to<string_view> key_type> JSONIFIER_INLINE raw_json_data operator[](key_type&& key) const noexcept {
+			const auto object = getObject();
+			const auto iter	  = object.find(key);
+			return iter != object.end() ? (*iter).second : raw_json_data{};
 		}
 
 		template<std::convertible_to<string_view> key_type> JSONIFIER_INLINE bool contains(key_type&& key) const noexcept {
-			if (!std::holds_alternative<object_type>(value)) {
-				return false;
-			}
-			const auto& object = std::get<object_type>(value);
-			return object.contains(key);
+			const auto object = getObject();
+			return object.find(key) != object.end();
 		}
 
 		JSONIFIER_INLINE size_t size() const noexcept {
-			if (std::holds_alternative<object_type>(value)) {
-				return std::get<object_type>(value).size();
-			} else if (std::holds_alternative<array_type>(value)) {
-				return std::get<array_type>(value).size();
-			} else if (std::holds_alternative<string_type>(value)) {
-				return std::get<string_type>(value).size();
-			} else {
-				return 0;
+			switch (getType()) {
+				case json_type::object: {
+					return getObject().size();
+				}
+				case json_type::array: {
+					return getArray().size();
+				}
+				case json_type::string: {
+					return getString().size();
+				}
+				default: {
+					return 0;
+				}
 			}
 		}
 
 		JSONIFIER_INLINE string_view rawJson() const noexcept {
-			return jsonData;
-		}
-
-		JSONIFIER_INLINE const std::vector<internal::error>& getErrors() const noexcept {
-			return errors;
+			if (!document) {
+				return {};
+			}
+			return index == 0 ? document->getSource() : document->getValue(index);
 		}
 
 		JSONIFIER_INLINE bool operator==(const raw_json_data& other) const noexcept {
-			return jsonData == other.jsonData && value == other.value;
+			return rawJson() == other.rawJson();
 		}
 
 	  protected:
-		std::vector<internal::error> errors{};
-		string_view jsonData{};
-		value_type value{};
+		std::shared_ptr<const internal::raw_json_document> document{};
+		uint32_t index{};
 
-		template<typename parser_type> JSONIFIER_INLINE auto constructValueFromRawJsonData(parser_type& parser, const string& jsonDataNew) noexcept {
-			static constexpr parse_options optionsNew{};
-			if (jsonDataNew.size() > 0) {
-				switch (jsonDataNew[0]) {
-					case '{': {
-						typename raw_json_data::object_type results{};
-						internal::parse_context<typename parser_type::derived_type, string_view_ptr> context{};
-						context.parserPtr = &parser;
-						context.rootIter  = jsonDataNew.data();
-						context.endIter	  = jsonDataNew.data() + jsonDataNew.size();
-						context.iter	  = jsonDataNew.data();
-						internal::parse_impl<typename raw_json_data::object_type, internal::parse_context<typename parser_type::derived_type, string_view_ptr>, optionsNew,
-							false>::impl(results, context);
-						if (parser.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case '[': {
-						typename raw_json_data::array_type results{};
-						internal::parse_context<typename parser_type::derived_type, string_view_ptr> context{};
-						context.parserPtr = &parser;
-						context.rootIter  = jsonDataNew.data();
-						context.endIter	  = jsonDataNew.data() + jsonDataNew.size();
-						context.iter	  = jsonDataNew.data();
-						internal::parse_impl<typename raw_json_data::array_type, internal::parse_context<typename parser_type::derived_type, string_view_ptr>, optionsNew,
-							false>::impl(results, context);
-						if (parser.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case '"': {
-						typename raw_json_data::string_type results{};
-						internal::parse_context<typename parser_type::derived_type, string_view_ptr> context{};
-						context.parserPtr = &parser;
-						context.rootIter  = jsonDataNew.data();
-						context.endIter	  = jsonDataNew.data() + jsonDataNew.size();
-						context.iter	  = jsonDataNew.data();
-						internal::parse_impl<typename raw_json_data::string_type, internal::parse_context<typename parser_type::derived_type, string_view_ptr>, optionsNew,
-							false>::impl(results, context);
-						if (parser.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case 't':
-						return value_type{ bool_type{ true } };
-					case 'f': {
-						return value_type{ bool_type{ false } };
-					}
-					case 'n': {
-						return value_type{ null_type{} };
-					}
-					case '0':
-						[[fallthrough]];
-					case '1':
-						[[fallthrough]];
-					case '2':
-						[[fallthrough]];
-					case '3':
-						[[fallthrough]];
-					case '4':
-						[[fallthrough]];
-					case '5':
-						[[fallthrough]];
-					case '6':
-						[[fallthrough]];
-					case '7':
-						[[fallthrough]];
-					case '8':
-						[[fallthrough]];
-					case '9':
-						[[fallthrough]];
-					case '-': {
-						return value_type{ number_type{ jsonDataNew } };
-					}
-					default: {
-						return value_type{ null_type{} };
-					}
-				}
-			} else {
-				return value_type{ null_type{} };
-			}
-		}
+		JSONIFIER_INLINE raw_json_data(const std::shared_ptr<const internal::raw_json_document>& documentNew, uint32_t indexNew) noexcept
+			: document{ documentNew }, index{ indexNew } {};
 	};
 
 	std::ostream& operator<<(std::ostream& os, const raw_json_data& jsonValue) noexcept {
 		os << jsonValue.rawJson();
 		return os;
 	}
-}
\ No newline at end of file
+}
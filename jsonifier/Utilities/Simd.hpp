@@ -33,15 +33,17 @@ namespace jsonifier::internal {
 
 	class string_block_reader {
 	  public:
-		JSONIFIER_INLINE void reset(string_view_ptr stringViewNew, uint64_t lengthNew) noexcept {
-			lengthMinusStep = lengthNew < bitsPerStep ? 0 : lengthNew - bitsPerStep;
+		/// @brief With padded, the input is followed by paddingBytes of whitespace, so its last block is read in place as a full one instead of being
+		/// copied out into a whitespace-filled block.
+		JSONIFIER_INLINE void reset(string_view_ptr stringViewNew, uint64_t lengthNew, bool padded = false) noexcept {
+			lengthMinusStep = padded ? lengthNew : lengthNew < bitsPerStep ? 0 : lengthNew - bitsPerStep;
 			inString		= stringViewNew;
 			length			= lengthNew;
 			index			= 0;
 		}
 
 		JSONIFIER_INLINE string_view_ptr getRemainder() noexcept {
-			if JSONIFIER_UNLIKELY (length == index) {
+			if JSONIFIER_UNLIKELY (index >= length) {
 				return nullptr;
 			}
 			std::fill_n(block, bitsPerStep, static_cast<char>(0x20));
@@ -67,37 +69,212 @@ namespace jsonifier::internal {
 		uint64_t index{};
 	};
 
-	template<bool doWeUseInitialBuffer> class simd_string_reader : public alloc_wrapper<structural_index> {
+	/// @brief One '{' or '[' of the tape: its tape index, the tape index of its matching close (the tape's end when it is never closed), and the
+	/// ordinal of the first bracket pair opened after that close.
+	struct bracket_match {
+		uint32_t open;
+		uint32_t close;
+		uint32_t next;
+	};
+
+	template<bool doWeUseInitialBuffer, typename allocator_type = aligned_allocator> class simd_string_reader : public alloc_wrapper<structural_index, allocator_type> {
 	  public:
 		using size_type = uint64_t;
-		using allocator = alloc_wrapper<structural_index>;
+		using allocator = alloc_wrapper<structural_index, allocator_type>;
 		static constexpr double multiplier{ 4.5f / 5.0f };
+		static constexpr size_type initialLazyWindowSize{ 64 * 1024 };
+		/// @brief Entries a lazily indexed tape is sized for at most; past it, consumed entries are dropped as windows are appended.
+		static constexpr size_type maxLazyTapeSize{ 1ull << 22 };
+		/// @brief Entries a fixed tape is given at the least, so that a sliding window still fits in it.
+		static constexpr size_type minFixedTapeSize{ 8192 };
+		/// @brief Entries a tape is sized for at the least, one block's worth, since a block's structurals are all written out before the count is checked.
+		static constexpr size_type minTapeSize{ bitsPerStep };
+
+		JSONIFIER_INLINE simd_string_reader() noexcept = default;
+
+		/// @brief The tape and the bracket table are both drawn from allocatorNew.
+		JSONIFIER_INLINE explicit simd_string_reader(const allocator_type& allocatorNew) noexcept : allocator{ allocatorNew } {
+		}
+
+		/// @brief Sets the entries the tape is allocated with the first time it is needed; nothing is allocated before then.
+		JSONIFIER_INLINE void setInitialTapeSize(size_type initialTapeSizeNew) noexcept {
+			initialTapeSize = initialTapeSizeNew;
+		}
 
-		JSONIFIER_INLINE simd_string_reader() noexcept {
-			if constexpr (doWeUseInitialBuffer) {
-				resize(1024 * 1024 * 4);
+		/// @brief Allocates the tape now, with its initial size or minFixedTapeSize entries if that is more, and keeps reset and resetLazy from ever
+		/// growing it: reset then reports an input the tape cannot hold through isOverrun and a nullptr begin(), and resetLazy indexes it on a sliding tape.
+		JSONIFIER_INLINE void setFixedTape(bool fixedTapeNew) noexcept {
+			fixedTape = fixedTapeNew;
+			const size_type fixedTapeSize{ initialTapeSize > minFixedTapeSize ? initialTapeSize : minFixedTapeSize };
+			if (fixedTape && structuralIndexCount < fixedTapeSize) {
+				resize(fixedTapeSize);
 			}
 		}
 
-		template<bool minified> JSONIFIER_INLINE void reset(const void* stringViewNew, size_type size) noexcept {
+		JSONIFIER_INLINE bool isTapeFixed() const noexcept {
+			return fixedTape;
+		}
+
+		/// @brief Whether the last reset found its input too large for a fixed tape.
+		JSONIFIER_INLINE bool isOverrun() const noexcept {
+			return overrun;
+		}
+
+		/// @brief Bytes currently held by the tape and the bracket table.
+		JSONIFIER_INLINE size_type getScratchBytes() const noexcept {
+			return structuralIndexCount * sizeof(structural_index) + bracketCapacity * (sizeof(bracket_match) + sizeof(uint32_t));
+		}
+
+		/// @brief Frees the tape and the bracket table; the next reset allocates them again.
+		JSONIFIER_INLINE void release() noexcept {
+			clearBrackets();
+			clear();
+		}
+
+		/// @brief Indexes stringViewNew into the tape; with matchBrackets, also fills the table returned by getBrackets.
+		template<bool minified, bool matchBrackets = false> JSONIFIER_INLINE void reset(const void* stringViewNew, size_type size, bool padded = false) noexcept {
 			currentParseBuffer = string_view_base{ static_cast<string_view_ptr>(stringViewNew), size };
+			paddedBuffer	   = padded;
 			auto newSize	   = roundUpToMultiple<8ull>(static_cast<size_type>(static_cast<double>(currentParseBuffer.size()) * multiplier));
+			newSize			   = newSize > minTapeSize ? newSize : minTapeSize;
+			overrun			   = fixedTape && structuralIndexCount < currentParseBuffer.size() + bitsPerStep;
+			if JSONIFIER_UNLIKELY (overrun) {
+				tapeIndex	= 0;
+				windowsDone = true;
+				return;
+			}
 			if JSONIFIER_UNLIKELY (structuralIndexCount < newSize) {
-				resize(newSize * 2);
+				growTape(newSize * 2);
 			}
-			resetImpl<minified>();
+			if constexpr (matchBrackets) {
+				if JSONIFIER_UNLIKELY (bracketCapacity < structuralIndexCount + 1) {
+					clearBrackets();
+					brackets  = allocator::template allocate<bracket_match>(structuralIndexCount + 1);
+					openStack = allocator::template allocate<uint32_t>(structuralIndexCount + 2);
+					if JSONIFIER_UNLIKELY (!brackets || !openStack) {
+						releaseBracketTable(structuralIndexCount + 1);
+						clear();
+						tapeIndex	= 0;
+						windowsDone = true;
+						return;
+					}
+					bracketCapacity = structuralIndexCount + 1;
+				}
+				openDepth	 = 0;
+				bracketCount = 0;
+			}
+			resetImpl<minified, matchBrackets>();
+		}
+
+		/// @brief Prepares stringViewNew for indexing in windows of windowSizeNew bytes, so the tape only ever holds one window's structurals.
+		template<bool minified> JSONIFIER_INLINE void resetWindowed(const void* stringViewNew, size_type size, size_type windowSizeNew) noexcept {
+			currentParseBuffer = string_view_base{ static_cast<string_view_ptr>(stringViewNew), size };
+			windowSize		   = roundUpToMultiple<bitsPerStep>(windowSizeNew);
+			if JSONIFIER_UNLIKELY (structuralIndexCount < windowSize + bitsPerStep) {
+				growTape(windowSize + bitsPerStep);
+			}
+			stringBlockReader.reset(currentParseBuffer.data(), currentParseBuffer.size());
+			windowNextIsEscaped = jsonifier_simd_int_t{};
+			windowEscaped		= jsonifier_simd_int_t{};
+			windowsDone			= false;
+			overflow			= false;
+			overrun				= false;
+			prevInString		= 0;
+			stringIndex			= 0;
+			tapeIndex			= 0;
+		}
+
+		/// @brief Moves the carryCount unconsumed entries at carryBegin to the front of the tape and indexes the next window behind them.
+		/// Returns false once the whole input has been indexed.
+		template<bool minified> JSONIFIER_INLINE bool nextWindow(string_view_ptr* carryBegin, size_type carryCount) noexcept {
+			if (windowsDone) {
+				return false;
+			}
+			std::memmove(structuralIndices, carryBegin, carryCount * sizeof(structural_index));
+			tapeIndex = carryCount;
+			indexWindow<minified>(windowSize);
+			return true;
+		}
+
+		/// @brief Prepares stringViewNew for indexing on demand through appendWindow. Up to maxLazyTapeSize the tape is sized for the whole input, so
+		/// entries already handed out stay put as later windows are appended, and a parse that stops early never pays for indexing the rest. Larger
+		/// inputs get a tape of that bound which slides along behind the parse, so its memory no longer grows with the input; a fixed tape slides in
+		/// place once the input needs more than half of it.
+		template<bool minified> JSONIFIER_INLINE void resetLazy(const void* stringViewNew, size_type size, bool padded = false) noexcept {
+			currentParseBuffer = string_view_base{ static_cast<string_view_ptr>(stringViewNew), size };
+			auto newSize	   = roundUpToMultiple<8ull>(static_cast<size_type>(static_cast<double>(currentParseBuffer.size()) * multiplier));
+			newSize			   = newSize > minTapeSize ? newSize : minTapeSize;
+			const size_type lazyTapeSize{ fixedTape ? structuralIndexCount / 2 : maxLazyTapeSize };
+			slidingTape = newSize > lazyTapeSize;
+			newSize		= slidingTape ? lazyTapeSize : newSize;
+			if JSONIFIER_UNLIKELY (structuralIndexCount < newSize) {
+				growTape(newSize * 2);
+			}
+			tapeIndex = 0;
+			if JSONIFIER_UNLIKELY (!structuralIndices) {
+				windowsDone = true;
+				return;
+			}
+			stringBlockReader.reset(currentParseBuffer.data(), currentParseBuffer.size(), padded);
+			windowNextIsEscaped = jsonifier_simd_int_t{};
+			windowEscaped		= jsonifier_simd_int_t{};
+			windowSize			= initialLazyWindowSize;
+			windowsDone			= false;
+			overflow			= false;
+			overrun				= false;
+			prevInString		= 0;
+			stringIndex			= 0;
+			structural_index* cursor{ structuralIndices };
+			appendWindow<minified>(cursor);
+		}
+
+		/// @brief Indexes the next window onto the end of the tape, each window as large as everything indexed before it, so the total work stays
+		/// within twice the prefix the parse actually reached. On a sliding tape the window is capped to a quarter of the tape, and when it would not
+		/// fit, the entries behind cursor are dropped first and cursor is moved along with the rest. Returns false once the whole input has been indexed.
+		template<bool minified> JSONIFIER_INLINE bool appendWindow(structural_index*& cursor) noexcept {
+			if (windowsDone) {
+				return false;
+			}
+			size_type byteCount{ stringIndex > windowSize ? stringIndex : windowSize };
+			if JSONIFIER_UNLIKELY (slidingTape) {
+				byteCount = byteCount < structuralIndexCount / 4 ? byteCount : structuralIndexCount / 4;
+				if (tapeIndex + byteCount + 2 * bitsPerStep > structuralIndexCount) {
+					slideTape(cursor);
+				}
+			}
+			indexWindow<minified>(byteCount);
+			structuralIndices[tapeIndex] = currentParseBuffer.data() + currentParseBuffer.size();
+			return true;
+		}
+
+		JSONIFIER_INLINE bool hasMoreWindows() const noexcept {
+			return !windowsDone;
 		}
 
 		JSONIFIER_INLINE auto end() noexcept {
 			return structuralIndices + tapeIndex;
 		}
 
-		JSONIFIER_INLINE auto begin() noexcept {
+		/// @brief The first entry of the tape, or nullptr when the tape could not be allocated or, being fixed, could not hold the input.
+		JSONIFIER_INLINE structural_index* begin() noexcept {
+			if JSONIFIER_UNLIKELY (!structuralIndices || overrun) {
+				return nullptr;
+			}
 			structuralIndices[tapeIndex] = currentParseBuffer.data() + currentParseBuffer.size();
 			return structuralIndices;
 		}
 
+		/// @brief The table built by reset<minified, true>, holding one entry per '{' and '[' of the tape in tape order.
+		JSONIFIER_INLINE const bracket_match* getBrackets() const noexcept {
+			return brackets;
+		}
+
+		JSONIFIER_INLINE size_type getBracketCount() const noexcept {
+			return bracketCount;
+		}
+
 		JSONIFIER_INLINE ~simd_string_reader() noexcept {
+			clearBrackets();
 			clear();
 		}
 
@@ -106,66 +283,176 @@ namespace jsonifier::internal {
 		string_block_reader stringBlockReader{};
 		structural_index* structuralIndices{};
 		size_type structuralIndexCount{};
+		bracket_match* brackets{};
+		size_type bracketCapacity{};
+		size_type bracketCount{};
+		uint32_t* openStack{};
+		uint64_t openDepth{};
 		string_view currentParseBuffer{};
 		size_type stringIndex{};
 		int64_t prevInString{};
+		jsonifier_simd_int_t windowNextIsEscaped{};
+		jsonifier_simd_int_t windowEscaped{};
+		size_type windowSize{};
 		size_type tapeIndex{};
+		size_type initialTapeSize{ doWeUseInitialBuffer ? 1024 * 1024 * 4 : 0 };
+		bool windowsDone{};
+		bool slidingTape{};
+		bool fixedTape{};
 		bool overflow{};
+		bool overrun{};
+		bool paddedBuffer{};
+
+		/// @brief Moves the entries from cursor on down to just behind the first entry, which stays put since error offsets are taken from it.
+		JSONIFIER_INLINE void slideTape(structural_index*& cursor) noexcept {
+			structural_index* keepBegin{ cursor > structuralIndices + 1 ? cursor : structuralIndices + 1 };
+			const size_type carryCount{ static_cast<size_type>((structuralIndices + tapeIndex) - keepBegin) };
+			std::memmove(structuralIndices + 1, keepBegin, carryCount * sizeof(structural_index));
+			cursor	  = cursor < keepBegin ? cursor : structuralIndices + 1;
+			tapeIndex = 1 + carryCount;
+		}
 
-		template<bool minified> JSONIFIER_INLINE void resetImpl() noexcept {
-			stringBlockReader.reset(currentParseBuffer.data(), currentParseBuffer.size());
+		template<bool minified> JSONIFIER_INLINE void indexWindow(size_type byteCount) noexcept {
+			simd::simd_int_t_holder rawStructurals{};
+			const size_type windowEnd{ stringIndex + byteCount };
+			while (stringIndex < windowEnd && stringBlockReader.hasFullBlock()) {
+				generateStructurals<false, minified>(stringBlockReader.fullBlock(), windowEscaped, windowNextIsEscaped, rawStructurals);
+			}
+			if (stringIndex < windowEnd) {
+				if JSONIFIER_LIKELY (auto newPtr = stringBlockReader.getRemainder(); newPtr) {
+					generateStructurals<true, minified>(newPtr, windowEscaped, windowNextIsEscaped, rawStructurals);
+				}
+				windowsDone = true;
+			}
+		}
+
+		template<bool minified, bool matchBrackets = false> JSONIFIER_INLINE void resetImpl() noexcept {
+			tapeIndex	= 0;
+			windowsDone = true;
+			if JSONIFIER_UNLIKELY (!structuralIndices) {
+				return;
+			}
+			stringBlockReader.reset(currentParseBuffer.data(), currentParseBuffer.size(), paddedBuffer);
 			overflow	 = false;
 			prevInString = 0;
 			stringIndex	 = 0;
-			tapeIndex	 = 0;
-			generateJsonIndices<minified>();
+			generateJsonIndices<minified, matchBrackets>();
+			if constexpr (matchBrackets) {
+				for (; openDepth > 0; --openDepth) {
+					brackets[openStack[openDepth]].close = static_cast<uint32_t>(tapeIndex);
+					brackets[openStack[openDepth]].next	 = static_cast<uint32_t>(bracketCount);
+				}
+			}
 		}
 
+		/// @brief Entries are only ever read back behind tapeIndex, so the new tape is left unwritten; pages the parse never reaches are never touched.
+		/// A tape that cannot be allocated is left empty, and begin() then reports it as nullptr.
 		JSONIFIER_INLINE void resize(size_type newSize) noexcept {
 			clear();
 			structuralIndices	 = allocator::allocate(newSize);
-			structuralIndexCount = newSize;
-			std::uninitialized_fill(structuralIndices, structuralIndices + structuralIndexCount, nullptr);
+			structuralIndexCount = structuralIndices ? newSize : 0;
+		}
+
+		JSONIFIER_INLINE void growTape(size_type newSize) noexcept {
+			resize(newSize > initialTapeSize ? newSize : initialTapeSize);
+		}
+
+		JSONIFIER_INLINE void clearBrackets() noexcept {
+			if (brackets) {
+				releaseBracketTable(bracketCapacity);
+				bracketCapacity = 0;
+			}
+		}
+
+		/// @brief Frees whichever of the bracket table and its open stack were allocated for capacity entries.
+		JSONIFIER_INLINE void releaseBracketTable(size_type capacity) noexcept {
+			if (brackets) {
+				allocator::deallocate(brackets, capacity);
+				brackets = nullptr;
+			}
+			if (openStack) {
+				allocator::deallocate(openStack, capacity + 1);
+				openStack = nullptr;
+			}
 		}
 
 		JSONIFIER_INLINE void clear() noexcept {
 			if (structuralIndices) {
-				allocator::deallocate(structuralIndices);
+				allocator::deallocate(structuralIndices, structuralIndexCount);
 				structuralIndices	 = nullptr;
 				structuralIndexCount = 0;
 			}
 		}
 
-		template<bool minified> JSONIFIER_INLINE void generateJsonIndices() noexcept {
+		template<bool minified, bool matchBrackets> JSONIFIER_INLINE void generateJsonIndices() noexcept {
 			simd::simd_int_t_holder rawStructurals{};
 			jsonifier_simd_int_t nextIsEscaped{};
 			jsonifier_simd_int_t escaped{};
 			while (stringBlockReader.hasFullBlock()) {
-				generateStructurals<false, minified>(stringBlockReader.fullBlock(), escaped, nextIsEscaped, rawStructurals);
+				generateStructurals<false, minified, matchBrackets>(stringBlockReader.fullBlock(), escaped, nextIsEscaped, rawStructurals);
 			}
 			if JSONIFIER_LIKELY (auto newPtr = stringBlockReader.getRemainder(); newPtr) {
-				generateStructurals<true, minified>(newPtr, escaped, nextIsEscaped, rawStructurals);
+				generateStructurals<true, minified, matchBrackets>(newPtr, escaped, nextIsEscaped, rawStructurals);
 			}
 		}
 
+		/// @brief Matches the brackets of the block just classified, before addTapeValues consumes newBits, while the block is still in cache. Each bracket's
+		/// tape index is the tape's size so far plus the structurals ahead of it in the block, so entries other than brackets cost nothing. The table is
+		/// kept in open order rather than indexed by tape position, so its writes stay dense however sparse the brackets are. Brackets are too irregular to
+		/// branch on: every one is written as the next open and pushed one slot above the stack's top, where both only survive if it is an open, and a
+		/// close resolves the entry on top of the stack, with a close that has nothing open resolving the scratch entry past the table's end.
+		template<bool collectAligned> JSONIFIER_INLINE void matchBlockBrackets(string_view_ptr values) noexcept {
+			jsonifier_simd_int_t newPtr[stridesPerStep];
+			collectStringValues<collectAligned>(values, newPtr);
+			JSONIFIER_ALIGN(bytesPerStep) size_type openBits[sixtyFourBitsPerStep];
+			JSONIFIER_ALIGN(bytesPerStep) size_type closeBits[sixtyFourBitsPerStep];
+			simd::store(simd::collectBracketIndices<false>(newPtr), openBits);
+			simd::store(simd::collectBracketIndices<true>(newPtr), closeBits);
+			size_type wordTapeIndex{ tapeIndex };
+			uint64_t depth{ openDepth };
+			size_type count{ bracketCount };
+			for (size_type x = 0; x < sixtyFourBitsPerStep; ++x) {
+				const size_type structurals{ newBits[x] };
+				const size_type opens{ openBits[x] & structurals };
+				size_type bracketBits{ (openBits[x] | closeBits[x]) & structurals };
+				while (bracketBits) {
+					const size_type bitIndex{ simd::tzcnt(bracketBits) };
+					const uint32_t entryIndex{ static_cast<uint32_t>(wordTapeIndex + popcnt(structurals & ((size_type{ 1 } << bitIndex) - 1))) };
+					const uint64_t isOpen{ (opens >> bitIndex) & 1 };
+					const uint64_t isClose{ (isOpen ^ 1) & static_cast<uint64_t>(depth != 0) };
+					bracket_match& resolved{ brackets[isClose ? openStack[depth] : bracketCapacity - 1] };
+					resolved.close		 = entryIndex;
+					resolved.next		 = static_cast<uint32_t>(count);
+					brackets[count].open = entryIndex;
+					openStack[depth + 1] = static_cast<uint32_t>(count);
+					count += isOpen;
+					depth		= depth + isOpen - isClose;
+					bracketBits = blsr(bracketBits);
+				}
+				wordTapeIndex += popcnt(structurals);
+			}
+			openDepth	 = depth;
+			bracketCount = count;
+		}
+
 		template<size_type index> JSONIFIER_INLINE size_type rollValuesIntoTape(size_type currentIndex, size_type newBitsNew) noexcept {
 			static constexpr size_type bitTotal{ index * 64ull };
 			const auto dataPtr									  = currentParseBuffer.data();
-			structuralIndices[0 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[0 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[1 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[1 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[2 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[2 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[3 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[3 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[4 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[4 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[5 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[5 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[6 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[6 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
-			structuralIndices[7 + (currentIndex * 8) + tapeIndex] = dataPtr + static_cast<uint32_t>(simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
+			structuralIndices[7 + (currentIndex * 8) + tapeIndex] = dataPtr + (simd::tzcnt(newBitsNew) + bitTotal + stringIndex);
 			newBitsNew											  = blsr(newBitsNew);
 			return newBitsNew;
 		}
@@ -214,11 +501,14 @@ namespace jsonifier::internal {
 			return simd::collectIndices<minified>(newPtr);
 		}
 
-		template<bool collectAligned, bool minified> JSONIFIER_INLINE void generateStructurals(string_view_ptr values, jsonifier_simd_int_t& escaped,
-			jsonifier_simd_int_t& nextIsEscaped, simd::simd_int_t_holder& rawStructurals) noexcept {
+		template<bool collectAligned, bool minified, bool matchBrackets = false> JSONIFIER_INLINE void generateStructurals(string_view_ptr values,
+			jsonifier_simd_int_t& escaped, jsonifier_simd_int_t& nextIsEscaped, simd::simd_int_t_holder& rawStructurals) noexcept {
 			rawStructurals = getRawIndices<collectAligned, minified>(values);
 			collectStructurals<minified>(escaped, nextIsEscaped, rawStructurals);
 			simd::store(rawStructurals.op, newBits);
+			if constexpr (matchBrackets) {
+				matchBlockBrackets<collectAligned>(values);
+			}
 			addTapeValues();
 			stringIndex += bitsPerStep;
 		}
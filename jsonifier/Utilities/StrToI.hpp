@@ -236,6 +236,11 @@ namespace jsonifier::internal {
 			}
 		}
 
+		/// @brief Negates through the unsigned type, so that the magnitude of the minimum value wraps back onto it instead of overflowing.
+		JSONIFIER_INLINE static void negate(value_type& value) noexcept {
+			value = static_cast<value_type>(0 - static_cast<std::make_unsigned_t<value_type>>(value));
+		}
+
 		template<bool negative> JSONIFIER_INLINE static const uint8_t* parseInteger(value_type& value, const uint8_t* iter) noexcept {
 			using v_type_local = std::make_unsigned_t<value_type>;
 			uint8_t numTmp{ *iter };
@@ -255,14 +260,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -280,14 +285,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -301,14 +306,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -322,14 +327,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -343,14 +348,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -364,14 +369,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -385,14 +390,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -406,14 +411,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -427,14 +432,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -448,14 +453,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -469,14 +474,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -490,14 +495,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -511,14 +516,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -532,14 +537,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -553,14 +558,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -574,14 +579,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -595,14 +600,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -619,14 +624,14 @@ namespace jsonifier::internal {
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
 					if constexpr (negative) {
-						value *= -1;
+						negate(value);
 						return iter;
 					} else {
 						return iter;
 					}
 				}
 				if constexpr (negative) {
-					return (iter = finishParse(value, iter), value *= -1, iter);
+					return (iter = finishParse(value, iter), negate(value), iter);
 				} else {
 					return finishParse(value, iter);
 				}
@@ -643,7 +648,12 @@ namespace jsonifier::internal {
 			}
 			JSONIFIER_ELSE_UNLIKELY(else) {
 				if JSONIFIER_LIKELY (!expFracTable[numTmp]) {
-					return iter;
+					if constexpr (negative) {
+						negate(value);
+						return iter;
+					} else {
+						return iter;
+					}
 				}
 			}
 			return nullptr;
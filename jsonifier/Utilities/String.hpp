@@ -86,7 +86,9 @@ namespace jsonifier {
 
 	template<typename value_type> class string_view_base;
 
-	template<typename value_type_new, uint64_t newerSize = 0> class string_base : protected internal::alloc_wrapper<value_type_new> {
+	/// @brief A growable string over allocator_type storage; see aligned_allocator for what an allocator needs to provide.
+	template<typename value_type_new, uint64_t newerSize = 0, typename allocator_type = aligned_allocator> class string_base
+		: protected internal::alloc_wrapper<value_type_new, allocator_type> {
 	  public:
 		using value_type			 = value_type_new;
 		using pointer				 = value_type*;
@@ -99,31 +101,36 @@ namespace jsonifier {
 		using reverse_iterator		 = std::reverse_iterator<iterator>;
 		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 		using size_type				 = uint64_t;
-		using allocator				 = internal::alloc_wrapper<value_type>;
+		using allocator				 = internal::alloc_wrapper<value_type, allocator_type>;
 		using traits_type			 = internal::char_traits<value_type>;
 
-		JSONIFIER_INLINE string_base() noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		JSONIFIER_INLINE string_base() noexcept(newerSize == 0) : capacityVal{}, sizeVal{}, dataVal{} {
 			if constexpr (newerSize > 0) {
 				resize(newerSize);
 			}
 		};
 
+		JSONIFIER_INLINE explicit string_base(const allocator_type& allocatorNew) noexcept : allocator{ allocatorNew }, capacityVal{}, sizeVal{}, dataVal{} {
+		}
+
+		using allocator::getAllocator;
+
 		inline static constexpr size_type bufSize = 16 / sizeof(value_type) < 1 ? 1 : 16 / sizeof(value_type);
 		inline static constexpr size_type npos{ std::numeric_limits<size_type>::max() };
 
 		JSONIFIER_INLINE string_base& operator=(string_base&& other) noexcept {
 			if JSONIFIER_LIKELY (this != &other) {
-				string_base newValue{ other };
+				string_base newValue{ internal::move(other) };
 				swap(newValue);
 			}
 			return *this;
 		}
 
-		JSONIFIER_INLINE explicit string_base(string_base&& other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		JSONIFIER_INLINE string_base(string_base&& other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
 			swap(other);
 		};
 
-		JSONIFIER_INLINE string_base& operator=(const string_base& other) noexcept {
+		JSONIFIER_INLINE string_base& operator=(const string_base& other) {
 			if JSONIFIER_LIKELY (this != &other) {
 				string_base newValue{ other };
 				swap(newValue);
@@ -131,7 +138,7 @@ namespace jsonifier {
 			return *this;
 		}
 
-		JSONIFIER_INLINE string_base(const string_base& other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		JSONIFIER_INLINE string_base(const string_base& other) : allocator{ other.getAllocator() }, capacityVal{}, sizeVal{}, dataVal{} {
 			size_type newSize = other.size();
 			if JSONIFIER_LIKELY (newSize > 0 && newSize < maxSize()) {
 				reserve(newSize);
@@ -141,13 +148,17 @@ namespace jsonifier {
 			}
 		}
 
-		template<concepts::string_t value_type_newer> JSONIFIER_INLINE string_base& operator=(value_type_newer&& other) noexcept {
+		template<concepts::string_t value_type_newer>
+			requires(!std::is_same_v<jsonifier::internal::remove_cvref_t<value_type_newer>, string_base>)
+		JSONIFIER_INLINE string_base& operator=(value_type_newer&& other) {
 			string_base newValue{ other };
 			swap(newValue);
 			return *this;
 		}
 
-		template<concepts::string_t value_type_newer> JSONIFIER_INLINE string_base(value_type_newer&& other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		template<concepts::string_t value_type_newer>
+			requires(!std::is_same_v<jsonifier::internal::remove_cvref_t<value_type_newer>, string_base>)
+		JSONIFIER_INLINE string_base(value_type_newer&& other) : capacityVal{}, sizeVal{}, dataVal{} {
 			size_type newSize = other.size() * (sizeof(typename jsonifier::internal::remove_cvref_t<value_type_newer>::value_type) / sizeof(value_type));
 			if JSONIFIER_LIKELY (newSize > 0 && newSize < maxSize()) {
 				reserve(newSize);
@@ -157,13 +168,13 @@ namespace jsonifier {
 			}
 		}
 
-		template<concepts::pointer_t value_type_newer> JSONIFIER_INLINE string_base& operator=(value_type_newer other) noexcept {
+		template<concepts::pointer_t value_type_newer> JSONIFIER_INLINE string_base& operator=(value_type_newer other) {
 			string_base newValue{ std::forward<value_type_newer>(other) };
 			swap(newValue);
 			return *this;
 		}
 
-		template<concepts::pointer_t value_type_newer> JSONIFIER_INLINE string_base(value_type_newer other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		template<concepts::pointer_t value_type_newer> JSONIFIER_INLINE string_base(value_type_newer other) : capacityVal{}, sizeVal{}, dataVal{} {
 			if (other) {
 				const auto newSize = internal::char_traits<jsonifier::internal::remove_pointer_t<value_type_newer>>::length(other) *
 					(sizeof(jsonifier::internal::remove_pointer_t<value_type_newer>) / sizeof(value_type));
@@ -176,16 +187,16 @@ namespace jsonifier {
 			}
 		}
 
-		template<concepts::char_t value_type_newer> JSONIFIER_INLINE string_base& operator=(value_type_newer other) noexcept {
+		template<concepts::char_t value_type_newer> JSONIFIER_INLINE string_base& operator=(value_type_newer other) {
 			emplace_back(static_cast<value_type>(other));
 			return *this;
 		}
 
-		template<concepts::char_t value_type_newer> JSONIFIER_INLINE string_base(value_type_newer other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		template<concepts::char_t value_type_newer> JSONIFIER_INLINE string_base(value_type_newer other) : capacityVal{}, sizeVal{}, dataVal{} {
 			*this = other;
 		}
 
-		JSONIFIER_INLINE string_base(const_pointer other, uint64_t newSize) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		JSONIFIER_INLINE string_base(const_pointer other, uint64_t newSize) : capacityVal{}, sizeVal{}, dataVal{} {
 			if JSONIFIER_LIKELY (newSize > 0 && newSize < maxSize()) {
 				reserve(newSize);
 				sizeVal = newSize;
@@ -194,7 +205,7 @@ namespace jsonifier {
 			}
 		}
 
-		JSONIFIER_INLINE string_base(const_iterator other, uint64_t newSize) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		JSONIFIER_INLINE string_base(const_iterator other, uint64_t newSize) : capacityVal{}, sizeVal{}, dataVal{} {
 			if JSONIFIER_LIKELY (newSize > 0 && newSize < maxSize()) {
 				reserve(newSize);
 				sizeVal = newSize;
@@ -280,7 +291,7 @@ namespace jsonifier {
 			return operator std::basic_string_view<value_type>().find_last_not_of(std::forward<arg_types>(args)...);
 		}
 
-		JSONIFIER_INLINE void append(const string_base& newSize) noexcept {
+		JSONIFIER_INLINE void append(const string_base& newSize) {
 			if JSONIFIER_UNLIKELY (sizeVal + newSize.size() >= capacityVal) {
 				reserve(sizeVal + newSize.size());
 			}
@@ -291,7 +302,7 @@ namespace jsonifier {
 			}
 		}
 
-		template<typename value_type_newer> JSONIFIER_INLINE void append(value_type_newer* values, uint64_t newSize) noexcept {
+		template<typename value_type_newer> JSONIFIER_INLINE void append(value_type_newer* values, uint64_t newSize) {
 			if JSONIFIER_UNLIKELY (sizeVal + newSize >= capacityVal) {
 				reserve(sizeVal + newSize);
 			}
@@ -302,7 +313,7 @@ namespace jsonifier {
 			}
 		}
 
-		template<typename Iterator01, typename Iterator02> JSONIFIER_INLINE void insert(Iterator01 where, Iterator02 start, Iterator02 end) noexcept {
+		template<typename Iterator01, typename Iterator02> JSONIFIER_INLINE void insert(Iterator01 where, Iterator02 start, Iterator02 end) {
 			int64_t newSize = end - start;
 			auto posNew		= where.operator->() - dataVal;
 
@@ -320,7 +331,7 @@ namespace jsonifier {
 			allocator::construct(&dataVal[sizeVal], value_type{});
 		}
 
-		JSONIFIER_INLINE void insert(iterator values, value_type toInsert) noexcept {
+		JSONIFIER_INLINE void insert(iterator values, value_type toInsert) {
 			auto positionNew = values - begin();
 			if JSONIFIER_UNLIKELY (sizeVal + 1 >= capacityVal) {
 				reserve((sizeVal + 1) * 2);
@@ -354,7 +365,7 @@ namespace jsonifier {
 			allocator::construct(&dataVal[sizeVal], static_cast<value_type>(0x00u));
 		}
 
-		JSONIFIER_INLINE void emplace_back(value_type value) noexcept {
+		JSONIFIER_INLINE void emplace_back(value_type value) {
 			if JSONIFIER_UNLIKELY (sizeVal + 1 >= capacityVal) {
 				reserve((sizeVal + 2) * 4);
 			}
@@ -388,7 +399,7 @@ namespace jsonifier {
 			return { dataVal, sizeVal };
 		}
 
-		template<typename value_type_newer> JSONIFIER_INLINE explicit operator string_base<value_type_newer>() const noexcept {
+		template<typename value_type_newer> JSONIFIER_INLINE explicit operator string_base<value_type_newer>() const {
 			string_base<value_type_newer> returnValue{};
 			if JSONIFIER_LIKELY (sizeVal > 0) {
 				returnValue.resize(sizeVal);
@@ -397,7 +408,7 @@ namespace jsonifier {
 			return returnValue;
 		}
 
-		template<typename value_type_newer> JSONIFIER_INLINE explicit operator std::basic_string<value_type_newer>() const noexcept {
+		template<typename value_type_newer> JSONIFIER_INLINE explicit operator std::basic_string<value_type_newer>() const {
 			std::basic_string<value_type_newer> returnValue{};
 			if JSONIFIER_LIKELY (sizeVal > 0) {
 				returnValue.resize(sizeVal);
@@ -417,15 +428,18 @@ namespace jsonifier {
 			if JSONIFIER_LIKELY (static_cast<int64_t>(newSize) > 0) {
 				if JSONIFIER_LIKELY (newSize > capacityVal) {
 					pointer newPtr = allocator::allocate(newSize + 1);
+					if JSONIFIER_UNLIKELY (!newPtr) {
+						throw std::bad_alloc{};
+					}
 					try {
 						if JSONIFIER_LIKELY (dataVal) {
 							if JSONIFIER_LIKELY (sizeVal > 0) {
 								std::uninitialized_move(dataVal, dataVal + sizeVal, newPtr);
 							}
-							allocator::deallocate(dataVal);
+							allocator::deallocate(dataVal, capacityVal + 1);
 						}
 					} catch (...) {
-						allocator::deallocate(newPtr);
+						allocator::deallocate(newPtr, newSize + 1);
 						throw;
 					}
 					capacityVal = newSize;
@@ -434,7 +448,7 @@ namespace jsonifier {
 					allocator::construct(newPtr + newSize, value_type{});
 					sizeVal = newSize;
 				} else if JSONIFIER_LIKELY (newSize > sizeVal) {
-					std::uninitialized_value_construct(dataVal + sizeVal, dataVal + capacityVal);
+					std::uninitialized_value_construct(dataVal + sizeVal, dataVal + newSize);
 					allocator::construct(dataVal + newSize, value_type{});
 					sizeVal = newSize;
 				} else if JSONIFIER_LIKELY (newSize < sizeVal) {
@@ -448,18 +462,41 @@ namespace jsonifier {
 			}
 		}
 
+		/// @brief Resizes like resize, but leaves any characters past the old size unset, for callers that are about to overwrite them.
+		void resize_uninitialized(size_type newSize) {
+			if JSONIFIER_LIKELY (static_cast<int64_t>(newSize) > 0) {
+				if JSONIFIER_LIKELY (newSize > capacityVal) {
+					reserve(newSize);
+				}
+				sizeVal = newSize;
+				allocator::construct(dataVal + sizeVal, value_type{});
+			} else {
+				clear();
+			}
+		}
+
+		/// @brief Grows the string by count unset characters and returns a pointer to the first of them.
+		JSONIFIER_INLINE pointer append_uninitialized(size_type count) {
+			const size_type oldSize{ sizeVal };
+			resize_uninitialized(sizeVal + count);
+			return dataVal + oldSize;
+		}
+
 		void reserve(size_type capacityNew) {
 			if JSONIFIER_LIKELY (capacityNew > capacityVal) {
 				pointer newPtr = allocator::allocate(capacityNew + 1);
+				if JSONIFIER_UNLIKELY (!newPtr) {
+					throw std::bad_alloc{};
+				}
 				try {
 					if JSONIFIER_LIKELY (dataVal) {
 						if JSONIFIER_LIKELY (sizeVal > 0) {
 							std::uninitialized_move(dataVal, dataVal + sizeVal, newPtr);
 						}
-						allocator::deallocate(dataVal);
+						allocator::deallocate(dataVal, capacityVal + 1);
 					}
 				} catch (...) {
-					allocator::deallocate(newPtr);
+					allocator::deallocate(newPtr, capacityNew + 1);
 					throw;
 				}
 				capacityVal = capacityNew;
@@ -509,76 +546,77 @@ namespace jsonifier {
 		}
 
 		template<typename string_base_new> JSONIFIER_INLINE void swap(string_base_new&& other) noexcept {
+			allocator::swapAllocator(other);
 			std::swap(capacityVal, other.capacityVal);
 			std::swap(sizeVal, other.sizeVal);
 			std::swap(dataVal, other.dataVal);
 		}
 
-		template<typename value_type_newer, size_type size> JSONIFIER_INLINE friend string_base operator+(const value_type_newer (&lhs)[size], const string_base& rhs) noexcept {
+		template<typename value_type_newer, size_type size> JSONIFIER_INLINE friend string_base operator+(const value_type_newer (&lhs)[size], const string_base& rhs) {
 			string_base newLhs{ lhs };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<typename value_type_newer, size_type size> JSONIFIER_INLINE friend string_base operator+=(const value_type_newer (&lhs)[size], const string_base& rhs) noexcept {
+		template<typename value_type_newer, size_type size> JSONIFIER_INLINE friend string_base operator+=(const value_type_newer (&lhs)[size], const string_base& rhs) {
 			string_base newLhs{ lhs };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE friend string_base operator+(string_type_new&& lhs, const string_base& rhs) noexcept {
+		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE friend string_base operator+(string_type_new&& lhs, const string_base& rhs) {
 			string_base newLhs{ lhs };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE friend string_base operator+=(string_type_new&& lhs, const string_base& rhs) noexcept {
+		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE friend string_base operator+=(string_type_new&& lhs, const string_base& rhs) {
 			string_base newLhs{ lhs };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		JSONIFIER_INLINE string_base operator+(const value_type& rhs) noexcept {
+		JSONIFIER_INLINE string_base operator+(const value_type& rhs) {
 			string_base newLhs{ *this };
 			newLhs.emplace_back(rhs);
 			return newLhs;
 		}
 
-		JSONIFIER_INLINE string_base& operator+=(const value_type& rhs) noexcept {
+		JSONIFIER_INLINE string_base& operator+=(const value_type& rhs) {
 			emplace_back(rhs);
 			return *this;
 		}
 
-		template<concepts::string_t string_type_new> JSONIFIER_INLINE string_base operator+(const string_type_new& rhs) const noexcept {
+		template<concepts::string_t string_type_new> JSONIFIER_INLINE string_base operator+(const string_type_new& rhs) const {
 			string_base newLhs{ *this };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<concepts::string_t string_type_new> JSONIFIER_INLINE string_base& operator+=(const string_type_new& rhs) noexcept {
+		template<concepts::string_t string_type_new> JSONIFIER_INLINE string_base& operator+=(const string_type_new& rhs) {
 			append(static_cast<string_base>(rhs));
 			return *this;
 		}
 
-		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE string_base operator+(string_type_new&& rhs) noexcept {
+		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE string_base operator+(string_type_new&& rhs) {
 			string_base newLhs{ *this };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE string_base& operator+=(string_type_new&& rhs) noexcept {
+		template<concepts::pointer_t string_type_new> JSONIFIER_INLINE string_base& operator+=(string_type_new&& rhs) {
 			string_base newRhs{ rhs };
 			*this += newRhs;
 			return *this;
 		}
 
-		template<typename value_type_newer, size_type size> JSONIFIER_INLINE string_base operator+(const value_type_newer (&rhs)[size]) const noexcept {
+		template<typename value_type_newer, size_type size> JSONIFIER_INLINE string_base operator+(const value_type_newer (&rhs)[size]) const {
 			string_base newLhs{ *this };
 			newLhs += rhs;
 			return newLhs;
 		}
 
-		template<typename value_type_newer, size_type size> JSONIFIER_INLINE string_base& operator+=(const value_type_newer (&rhs)[size]) noexcept {
+		template<typename value_type_newer, size_type size> JSONIFIER_INLINE string_base& operator+=(const value_type_newer (&rhs)[size]) {
 			string_base newRhs{ rhs };
 			*this += newRhs;
 			return *this;
@@ -599,7 +637,7 @@ namespace jsonifier {
 					std::destroy(dataVal, dataVal + sizeVal);
 					sizeVal = 0;
 				}
-				allocator::deallocate(dataVal);
+				allocator::deallocate(dataVal, capacityVal + 1);
 				dataVal		= nullptr;
 				capacityVal = 0;
 			}
@@ -608,7 +646,8 @@ namespace jsonifier {
 
 	using string = string_base<char>;
 
-	template<typename value_type> std::ostream& operator<<(std::ostream& os, const string_base<value_type>& stringNew) noexcept {
+	template<typename value_type, uint64_t newerSize, typename allocator_type>
+	std::ostream& operator<<(std::ostream& os, const string_base<value_type, newerSize, allocator_type>& stringNew) noexcept {
 		os << stringNew.data();
 		return os;
 	}
@@ -28,6 +28,7 @@
 #include <jsonifier/Utilities/StrToD.hpp>
 #include <jsonifier/Utilities/Error.hpp>
 #include <jsonifier/Utilities/Simd.hpp>
+#include <jsonifier/Utilities/PaddedString.hpp>
 
 namespace jsonifier {
 
@@ -43,15 +44,74 @@ namespace jsonifier {
 		bool partialRead{};
 		bool knownOrder{};
 		bool minified{};
+		/// @brief Count each array's and map's direct children with a string-aware scan ahead of it and reserve them in one go. partialRead always does
+		/// this, since it only has to walk the structural tape.
+		bool reserveContainers{};
+		/// @brief With partialRead, pair every '{' and '[' with its close while building the tape, so skipping an unknown object or array is a single
+		/// jump instead of a walk over every structural inside it. It pays for itself once skipped values are large; on small, bracket-dense values the
+		/// walk stays cheaper. Inputs of 4 GiB or more are walked regardless, since the table holds 32-bit tape indices.
+		bool matchBrackets{};
+		/// @brief Choose between the minified and whitespace-tolerant parses at runtime, from whether the first few kilobytes carry any whitespace
+		/// between tokens; minified is then ignored. Surrounding whitespace is trimmed first, and a minified parse that fails is retried as a
+		/// whitespace-tolerant one, so input that only turns pretty further in still parses.
+		bool detectMinified{};
+		/// @brief The input is followed by at least paddingBytes readable bytes of whitespace, as a padded_view or padded_string guarantees, so peeks
+		/// that fit inside the padding drop their bounds checks and partialRead indexes the last block in place rather than copying it out. Parsing a
+		/// padded_view or padded_string turns this on by itself.
+		bool paddedInput{};
+	};
+
+	/// @brief Sizes of the scratch buffers a jsonifier::scratch allocates the first time a call needs them, and how much of them it keeps between calls.
+	struct scratch_options {
+		/// @brief Bytes the string buffer, used by serializeJson and for unescaping strings while parsing, is first allocated with.
+		uint64_t initialStringBufferSize{};
+		/// @brief Entries the structural tape, used by validateJson, prettifyJson and partialRead parses, is first allocated with.
+		uint64_t initialTapeSize{};
+		/// @brief When non-zero, a call that leaves the scratch buffers holding more than this many bytes releases them back under it before it returns.
+		uint64_t highWaterMark{};
+		/// @brief Allocates the string buffer, the tape and room for the errors once, when the options are set, and keeps parseJson and validateJson
+		/// from ever growing them: input they cannot hold is reported as Capacity_Exceeded instead. Serializing calls still grow the string buffer, and
+		/// have no way to fail partway through, so a resource they exhaust ends in std::terminate; give them an upstream resource to fall back on.
+		bool fixedCapacity{};
 	};
 
 }
 
 namespace jsonifier::internal {
 
+	/// @brief Applies a scratch's scratch_options::highWaterMark as the outermost call it is declared in returns, so a validateJson run from inside
+	/// parseJson leaves the parse's tape alone.
+	template<typename scratch_type> struct scratch_limit_guard {
+		JSONIFIER_INLINE explicit scratch_limit_guard(scratch_type& scratchNew) noexcept : scratchRef{ scratchNew } {
+			++scratchRef.scratchCallDepth;
+		}
+
+		JSONIFIER_INLINE ~scratch_limit_guard() noexcept {
+			if (--scratchRef.scratchCallDepth == 0) {
+				if (const uint64_t highWaterMark{ scratchRef.getScratchOptions().highWaterMark }; highWaterMark > 0) {
+					scratchRef.shrinkTo(highWaterMark);
+				}
+			}
+		}
+
+	  protected:
+		scratch_type& scratchRef;
+	};
+
 #define JSONIFIER_SKIP_WS() \
-	while ((context.iter < context.endIter) && whitespaceTable[static_cast<uint8_t>(*context.iter)]) { \
+	if ((context.iter < context.endIter) && whitespaceTable[static_cast<uint8_t>(*context.iter)]) { \
 		++context.iter; \
+		context.iter = whitespace_skipper<char>::skip(context.iter, static_cast<uint64_t>(context.endIter - context.iter)); \
+	}
+
+	/// @brief Whether the byteCount + 1 bytes at iter are inside the input. With paddedInput any such read that fits in the padding is, and since the
+	/// padding is whitespace, a peek past the end fails its comparison just as the bounds check would have.
+	template<parse_options options, uint64_t byteCount = 0, typename iterator> JSONIFIER_INLINE static constexpr bool canRead(iterator iter, iterator end) noexcept {
+		if constexpr (options.paddedInput && !options.partialRead && byteCount < paddingBytes) {
+			return true;
+		} else {
+			return (iter + byteCount) < end;
+		}
 	}
 
 	template<typename iterator01, typename iterator02> JSONIFIER_INLINE static void skipMatchingWs(iterator01 wsStart, iterator02& context, uint64_t length) noexcept {
@@ -335,6 +395,92 @@ namespace jsonifier::internal {
 		}
 	}
 
+	/// @brief Counts the direct children of the array or object whose body starts at iter, by counting the commas at its own depth before the
+	/// closing bracket. Strings are stepped over with skipStringImpl, so only the bytes between values are looked at one at a time.
+	JSONIFIER_INLINE static uint64_t countDirectChildren(string_view_ptr iter, string_view_ptr end) noexcept {
+		uint64_t depth{};
+		uint64_t count{ 1 };
+		while (iter < end) {
+			switch (*iter) {
+				case '"': {
+					++iter;
+					skipStringImpl(iter, static_cast<uint64_t>(end - iter));
+					break;
+				}
+				case '[':
+				case '{': {
+					++depth;
+					break;
+				}
+				case ']':
+				case '}': {
+					if (depth == 0) {
+						return count;
+					}
+					--depth;
+					break;
+				}
+				case ',': {
+					count += (depth == 0);
+					break;
+				}
+				default: {
+					break;
+				}
+			}
+			++iter;
+		}
+		return count;
+	}
+
+	/// @brief The same count over the structural tape, where string contents never appear.
+	JSONIFIER_INLINE static uint64_t countDirectChildren(string_view_ptr* iter, string_view_ptr* end) noexcept {
+		uint64_t depth{};
+		uint64_t count{ 1 };
+		for (; iter < end; ++iter) {
+			switch (**iter) {
+				case '[':
+				case '{': {
+					++depth;
+					break;
+				}
+				case ']':
+				case '}': {
+					if (depth == 0) {
+						return count;
+					}
+					--depth;
+					break;
+				}
+				case ',': {
+					count += (depth == 0);
+					break;
+				}
+				default: {
+					break;
+				}
+			}
+		}
+		return count;
+	}
+
+	/// @brief Whether [iter, end) has no whitespace between tokens within its first minifiedProbeLength bytes. Strings are stepped over with
+	/// skipStringImpl, so whitespace inside them does not count.
+	JSONIFIER_INLINE static bool looksMinified(string_view_ptr iter, string_view_ptr end) noexcept {
+		static constexpr uint64_t minifiedProbeLength{ 4096 };
+		const string_view_ptr probeEnd{ static_cast<uint64_t>(end - iter) > minifiedProbeLength ? iter + minifiedProbeLength : end };
+		while (iter < probeEnd) {
+			if (*iter == '"') {
+				++iter;
+				skipStringImpl(iter, static_cast<uint64_t>(end - iter));
+			} else if (whitespaceTable[static_cast<uint8_t>(*iter)]) {
+				return false;
+			}
+			++iter;
+		}
+		return true;
+	}
+
 	inline constexpr array<char, 256> escapeMap{ []() constexpr {
 		array<char, 256> returnValues{};
 		returnValues['"']  = '\"';
@@ -715,17 +861,29 @@ namespace jsonifier::internal {
 	}();
 
 	template<const auto options, typename context_type> struct derailleur {
+		/// @brief Unescapes the string at context.iter through the string buffer into value. A partialRead string is bounded by the next tape entry; any
+		/// other is unescaped into the buffer as it stands, and only a string that outruns it grows the buffer to the rest of the input and is read again.
+		/// A string that a fixedCapacity scratch's buffer or a fixed-capacity value cannot hold is reported as parse_errors::Capacity_Exceeded and stepped over.
 		template<typename value_type> JSONIFIER_INLINE static bool parseString(value_type& value, context_type& context) noexcept {
 			if constexpr (options.partialRead) {
 				if JSONIFIER_LIKELY ((context.iter < context.endIter) && **context.iter == '"') {
-					auto newerPtr	  = (*context.iter) + 1;
+					auto newerPtr = (*context.iter) + 1;
+					const uint64_t stringLength{ static_cast<uint64_t>(context.iter[1] - newerPtr) };
+					if JSONIFIER_UNLIKELY (context.parserPtr->getStringBuffer(stringLength).size() < stringLength) {
+						context.parserPtr->template reportError<parse_errors::Capacity_Exceeded>(context);
+						++context.iter;
+						return false;
+					}
 					const auto newPtr = string_parser<options, decltype(newerPtr), decltype(context.parserPtr->getStringBuffer().data())>::impl(newerPtr,
-						context.parserPtr->getStringBuffer().data(), static_cast<uint64_t>(*context.endIter - *context.iter));
+						context.parserPtr->getStringBuffer().data(), stringLength);
 					if JSONIFIER_LIKELY (newPtr) {
 						const auto newSize = static_cast<uint64_t>(newPtr - context.parserPtr->getStringBuffer().data());
+						if JSONIFIER_UNLIKELY (!fitsFixedCapacity(value, newSize, context)) {
+							return false;
+						}
 						if constexpr (concepts::has_resize<value_type>) {
 							if JSONIFIER_UNLIKELY (value.size() != newSize) {
-								value.resize(newSize);
+								resizeUninitialized(value, newSize);
 							}
 						}
 						std::memcpy(value.data(), context.parserPtr->getStringBuffer().data(), newSize);
@@ -744,13 +902,31 @@ namespace jsonifier::internal {
 			} else {
 				if JSONIFIER_LIKELY ((context.iter < context.endIter) && *context.iter == '"') {
 					++context.iter;
-					const auto newPtr = string_parser<options, decltype(context.iter), decltype(context.parserPtr->getStringBuffer().data())>::impl(context.iter,
-						context.parserPtr->getStringBuffer().data(), static_cast<uint64_t>(context.endIter - context.iter));
+					using string_parser_type = string_parser<options, decltype(context.iter), decltype(context.parserPtr->getStringBuffer().data())>;
+					const auto stringStart{ context.iter };
+					const uint64_t remainingLength{ static_cast<uint64_t>(context.endIter - context.iter) };
+					const uint64_t bufferLength{ context.parserPtr->getStringBuffer().size() };
+					const uint64_t boundedLength{ remainingLength < bufferLength ? remainingLength : bufferLength };
+					auto newPtr = string_parser_type::impl(context.iter, context.parserPtr->getStringBuffer().data(), boundedLength);
+					if JSONIFIER_UNLIKELY (newPtr && boundedLength < remainingLength && *context.iter != '"') {
+						context.iter = stringStart;
+						if JSONIFIER_UNLIKELY (context.parserPtr->getStringBuffer(remainingLength).size() < remainingLength) {
+							context.parserPtr->template reportError<parse_errors::Capacity_Exceeded>(context);
+							--context.iter;
+							skipString(context);
+							context.iter += (context.iter < context.endIter);
+							return false;
+						}
+						newPtr = string_parser_type::impl(context.iter, context.parserPtr->getStringBuffer().data(), remainingLength);
+					}
 					if JSONIFIER_LIKELY (newPtr) {
 						const auto newSize = static_cast<uint64_t>(newPtr - context.parserPtr->getStringBuffer().data());
+						if JSONIFIER_UNLIKELY (!fitsFixedCapacity(value, newSize, context)) {
+							return false;
+						}
 						if constexpr (concepts::has_resize<value_type>) {
 							if JSONIFIER_UNLIKELY (value.size() != newSize) {
-								value.resize(newSize);
+								resizeUninitialized(value, newSize);
 							}
 						}
 						std::memcpy(value.data(), context.parserPtr->getStringBuffer().data(), newSize);
@@ -769,6 +945,26 @@ namespace jsonifier::internal {
 			}
 		}
 
+		/// @brief Whether a string of newSize characters, unescaped into the string buffer, fits value. One that overflows a fixed-capacity value is
+		/// reported and truncated into it, as an overflowing array keeps its first elements, and context.iter is moved past the string as though it had been read.
+		template<typename value_type> JSONIFIER_INLINE static bool fitsFixedCapacity(value_type& value, uint64_t newSize, context_type& context) noexcept {
+			if constexpr (concepts::fixed_capacity_t<value_type>) {
+				if JSONIFIER_UNLIKELY (newSize > value_type::fixedCapacity) {
+					context.parserPtr->template reportError<parse_errors::Capacity_Exceeded>(context);
+					const auto stringBuffer = context.parserPtr->getStringBuffer().data();
+					uint64_t keptSize{ value_type::fixedCapacity };
+					while (keptSize > 0 && (static_cast<uint8_t>(stringBuffer[keptSize]) & 0xC0) == 0x80) {
+						--keptSize;
+					}
+					value.resize_uninitialized(keptSize);
+					std::memcpy(value.data(), stringBuffer, keptSize);
+					++context.iter;
+					return false;
+				}
+			}
+			return true;
+		}
+
 		JSONIFIER_INLINE static void skipString(context_type& context) noexcept {
 			if constexpr (options.partialRead) {
 				++context.iter;
@@ -804,16 +1000,38 @@ namespace jsonifier::internal {
 			}
 		}
 
-		template<char start, char end> JSONIFIER_INLINE static string_view_ptr getNextOpenOrClose(context_type& context, uint64_t length) {
-			string_view_ptr nextOpen  = char_comparison<start, char>::memchar(context.iter, length);
-			string_view_ptr nextClose = char_comparison<end, char>::memchar(context.iter, length);
-			return (nextClose && (nextClose < nextOpen || !nextOpen)) ? nextClose : nextOpen;
+		/// @brief Keeps a lazily indexed partialRead tape indexed far enough ahead of the cursor for the next value.
+		JSONIFIER_INLINE static void refillTape(context_type& context) noexcept {
+			if constexpr (options.partialRead) {
+				if JSONIFIER_UNLIKELY (context.endIter - context.iter < context.parserPtr->tapeLookahead && (!options.matchBrackets || !context.brackets)) {
+					context.parserPtr->template extendTape<options>(context);
+				}
+			}
+		}
+
+		/// @brief Whether the tape holds an entry at context.iter, indexing further windows first when the cursor has caught up with the indexed prefix.
+		JSONIFIER_INLINE static bool hasTapeEntry(context_type& context) noexcept {
+			if constexpr (options.partialRead) {
+				if JSONIFIER_UNLIKELY (context.iter >= context.endIter && (!options.matchBrackets || !context.brackets)) {
+					context.parserPtr->template extendTape<options>(context);
+				}
+			}
+			return context.iter < context.endIter;
+		}
+
+		/// @brief The next occurrence of value at or after context.iter, or context.endIter when there is none.
+		template<char value> JSONIFIER_INLINE static string_view_ptr findNext(context_type& context) noexcept {
+			string_view_ptr found{ char_comparison<value, char>::memchar(context.iter, static_cast<uint64_t>(context.endIter - context.iter)) };
+			return found ? found : context.endIter;
 		}
 
-		template<char valueStart, char valueEnd> JSONIFIER_INLINE static void skipToEndOfValue(context_type& context) {
+		/// @brief Moves past the close matching an already consumed open. Each of the next quote, open and close is found once with memchar and only
+		/// searched for again once the iterator has passed it, so strings are stepped over whole and the skip stays linear in the bytes skipped. Returns
+		/// false when the input ends before that close.
+		template<char valueStart, char valueEnd> JSONIFIER_INLINE static bool skipToEndOfValue(context_type& context) {
 			if constexpr (options.partialRead) {
 				uint64_t depth{ 1 };
-				while (depth > 0 && context.iter < context.endIter) {
+				while (depth > 0 && hasTapeEntry(context)) {
 					switch (**context.iter) {
 						case valueStart: {
 							++depth;
@@ -829,44 +1047,75 @@ namespace jsonifier::internal {
 					}
 					++context.iter;
 				}
+				return depth == 0;
 			} else {
-				uint64_t depth			 = 1;
-				uint64_t remainingLength = static_cast<uint64_t>(context.endIter - context.iter);
-				if (context.iter + bytesPerStep < context.endIter) {
-					string_view_ptr nextQuote		= char_comparison<'"', char>::memchar(context.iter, remainingLength);
-					string_view_ptr nextOpenOrClose = getNextOpenOrClose<valueStart, valueEnd>(context, remainingLength);
-
-					while (nextOpenOrClose && depth > 0 && context.iter + bytesPerStep < context.endIter) {
-						if (nextQuote && (nextQuote < nextOpenOrClose)) {
-							skipString(context);
-							++context.iter;
-							remainingLength = static_cast<uint64_t>(context.endIter - context.iter);
-							nextQuote		= static_cast<string_view_ptr>(std::memchr(context.iter, '"', remainingLength));
-						} else {
-							if (*nextOpenOrClose == valueEnd) {
-								--depth;
-							} else if (*nextOpenOrClose == valueStart) {
-								++depth;
-							}
-							context.iter = nextOpenOrClose;
-							if (depth == 0) {
-								++context.iter;
-								return;
-							}
-							++context.iter;
-							remainingLength = static_cast<uint64_t>(context.endIter - context.iter);
-							nextOpenOrClose = getNextOpenOrClose<valueStart, valueEnd>(context, remainingLength);
+				uint64_t depth{ 1 };
+				string_view_ptr nextQuote{ findNext<'"'>(context) };
+				string_view_ptr nextOpen{ findNext<valueStart>(context) };
+				string_view_ptr nextClose{ findNext<valueEnd>(context) };
+				while (nextClose < context.endIter) {
+					if (nextQuote < nextOpen && nextQuote < nextClose) {
+						context.iter = nextQuote;
+						skipString(context);
+						context.iter += (context.iter < context.endIter);
+						nextQuote = findNext<'"'>(context);
+						nextOpen  = nextOpen < context.iter ? findNext<valueStart>(context) : nextOpen;
+						nextClose = nextClose < context.iter ? findNext<valueEnd>(context) : nextClose;
+					} else if (nextOpen < nextClose) {
+						++depth;
+						context.iter = nextOpen + 1;
+						nextOpen	 = findNext<valueStart>(context);
+					} else {
+						context.iter = nextClose + 1;
+						if (--depth == 0) {
+							return true;
 						}
+						nextClose = findNext<valueEnd>(context);
 					}
 				}
+				context.iter = context.endIter;
+				return false;
 			}
 		}
 
+		/// @brief Moves a tape iterator sitting on a '{' or '[' to just past its matching close, using the bracket table built alongside the tape. The
+		/// tape is consumed front to back, so the bracket is found by walking a cursor forward over the brackets the parser descended into since the last
+		/// jump, and the cursor then resumes at the first bracket past the close, skipping every bracket nested inside in one step.
+		JSONIFIER_INLINE static void jumpPastMatchingClose(context_type& context) noexcept {
+			const uint64_t openIndex{ static_cast<uint64_t>(context.iter - context.rootIter) };
+			const bracket_match* brackets{ context.brackets };
+			uint64_t cursor{ context.bracketCursor };
+			if JSONIFIER_UNLIKELY (cursor >= context.bracketCount || brackets[cursor].open > openIndex) {
+				cursor = cursor < context.bracketCount ? cursor : context.bracketCount;
+				cursor = static_cast<uint64_t>(std::lower_bound(brackets, brackets + cursor, openIndex,
+													[](const bracket_match& bracket, uint64_t index) {
+														return bracket.open < index;
+													}) -
+					brackets);
+			}
+			while (cursor < context.bracketCount && brackets[cursor].open < openIndex) {
+				++cursor;
+			}
+			if JSONIFIER_UNLIKELY (cursor == context.bracketCount || brackets[cursor].open != openIndex) {
+				context.iter = context.endIter;
+				return;
+			}
+			const auto closeIter  = context.rootIter + brackets[cursor].close;
+			context.iter		  = closeIter < context.endIter ? closeIter + 1 : context.endIter;
+			context.bracketCursor = brackets[cursor].next;
+		}
+
 		static void skipObject(context_type& context) noexcept {
+			if constexpr (options.partialRead && options.matchBrackets) {
+				if JSONIFIER_LIKELY (context.brackets) {
+					jumpPastMatchingClose(context);
+					return;
+				}
+			}
 			if constexpr (options.partialRead) {
 				++context.iter;
 				uint64_t currentDepth{ 1 };
-				while (context.iter != context.endIter && currentDepth > 0) {
+				while (currentDepth > 0 && hasTapeEntry(context)) {
 					switch (**context.iter) {
 						[[unlikely]] case '{': {
 							++currentDepth;
@@ -944,10 +1193,16 @@ namespace jsonifier::internal {
 		}
 
 		static void skipArray(context_type& context) noexcept {
+			if constexpr (options.partialRead && options.matchBrackets) {
+				if JSONIFIER_LIKELY (context.brackets) {
+					jumpPastMatchingClose(context);
+					return;
+				}
+			}
 			if constexpr (options.partialRead) {
 				++context.iter;
 				uint64_t currentDepth{ 1 };
-				while (context.iter != context.endIter && currentDepth > 0) {
+				while (currentDepth > 0 && hasTapeEntry(context)) {
 					switch (**context.iter) {
 						[[unlikely]] case '[': {
 							++currentDepth;
@@ -998,6 +1253,7 @@ namespace jsonifier::internal {
 
 		static void skipToNextValue(context_type& context) noexcept {
 			if constexpr (options.partialRead) {
+				refillTape(context);
 				switch (**context.iter) {
 					case '{': {
 						skipObject(context);
@@ -1014,6 +1270,7 @@ namespace jsonifier::internal {
 						++context.iter;
 					}
 				}
+				refillTape(context);
 			} else {
 				if JSONIFIER_LIKELY ((context.iter + 1) < context.endIter) {
 					switch (*context.iter) {
@@ -1104,6 +1361,31 @@ namespace jsonifier::internal {
 			}
 		}
 
+		/// @brief Reports an array holding more values than the fixed-capacity container it is parsed into, and skips the values from context.iter on,
+		/// leaving context.iter on the array's closing ']'.
+		static void rejectExcessValues(context_type& context) noexcept {
+			context.parserPtr->template reportError<parse_errors::Capacity_Exceeded>(context);
+			while (context.iter < context.endIter) {
+				skipToNextValue(context);
+				if constexpr (options.partialRead) {
+					if ((context.iter < context.endIter) && **context.iter == ',') {
+						++context.iter;
+					} else {
+						return;
+					}
+				} else {
+					if ((context.iter < context.endIter) && *context.iter == ',') {
+						++context.iter;
+						if constexpr (!options.minified) {
+							JSONIFIER_SKIP_WS()
+						}
+					} else {
+						return;
+					}
+				}
+			}
+		}
+
 		template<typename iterator> JSONIFIER_INLINE static void skipWs(iterator& context) noexcept {
 			while (whitespaceTable[uint8_t(*context)]) {
 				++context;
@@ -0,0 +1,230 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/Compare.hpp>
+#include <jsonifier/Utilities/IToStr.hpp>
+#include <jsonifier/Utilities/Error.hpp>
+#include <chrono>
+
+namespace jsonifier::internal {
+
+	/// @brief Days since 1970-01-01 for a proleptic gregorian date (Howard Hinnant's days_from_civil).
+	JSONIFIER_INLINE constexpr int64_t daysFromCivil(int64_t year, uint64_t month, uint64_t day) noexcept {
+		year -= month <= 2;
+		const int64_t era  = (year >= 0 ? year : year - 399) / 400;
+		const uint64_t yoe = static_cast<uint64_t>(year - era * 400);
+		const uint64_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+		const uint64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+		return era * 146097 + static_cast<int64_t>(doe) - 719468;
+	}
+
+	struct civil_date {
+		int64_t year{};
+		uint64_t month{};
+		uint64_t day{};
+	};
+
+	/// @brief Inverse of daysFromCivil.
+	JSONIFIER_INLINE constexpr civil_date civilFromDays(int64_t days) noexcept {
+		days += 719468;
+		const int64_t era  = (days >= 0 ? days : days - 146096) / 146097;
+		const uint64_t doe = static_cast<uint64_t>(days - era * 146097);
+		const uint64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+		const uint64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+		const uint64_t mp  = (5 * doy + 2) / 153;
+		civil_date returnValue{};
+		returnValue.day	  = doy - (153 * mp + 2) / 5 + 1;
+		returnValue.month = mp < 10 ? mp + 3 : mp - 9;
+		returnValue.year  = static_cast<int64_t>(yoe) + era * 400 + (returnValue.month <= 2);
+		return returnValue;
+	}
+
+	JSONIFIER_INLINE constexpr uint64_t daysInMonth(int64_t year, uint64_t month) noexcept {
+		constexpr uint8_t monthLengths[]{ 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+		return monthLengths[month] + (month == 2 && (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)));
+	}
+
+	template<typename duration_type> static constexpr uint64_t fractionDigitCount() noexcept {
+		using period = typename duration_type::period;
+		if constexpr (period::den == 1) {
+			return 0;
+		} else if constexpr (period::den <= 1000) {
+			return 3;
+		} else if constexpr (period::den <= 1000000) {
+			return 6;
+		} else {
+			return 9;
+		}
+	}
+
+	template<typename value_type> struct time_point_parser {
+		using duration_type = typename value_type::duration;
+
+		/// @brief Parses a quoted rfc 3339 timestamp, "YYYY-MM-DDTHH:MM:SS[.f+](Z|+HH:MM|-HH:MM)".
+		/// The fixed-width date and time fields are each validated and decoded with one 8-byte swar step, and only the optional fraction and offset are scanned bytewise.
+		/// iterNew is only advanced, past the closing quote, on success, so that a failed timestamp is skipped as the string it started as.
+		JSONIFIER_INLINE static bool impl(value_type& value, string_view_ptr& iterNew, string_view_ptr end) noexcept {
+			static constexpr uint64_t dateTemplate{ packValues<"0000-00-">() };
+			static constexpr uint64_t dateSeparators{ 0xFF0000FF00000000ull };
+			static constexpr uint64_t timeTemplate{ packValues<"00:00:00">() };
+			static constexpr uint64_t timeSeparators{ 0x0000FF0000FF0000ull };
+			static constexpr uint64_t digitCeiling{ 0x7676767676767676ull };
+			static constexpr uint64_t highBits{ 0x8080808080808080ull };
+			string_view_ptr iter{ iterNew };
+			if JSONIFIER_UNLIKELY (end - iter < 22 || *iter != '"') {
+				return false;
+			}
+			++iter;
+			uint64_t dateWord;
+			uint64_t timeWord;
+			std::memcpy(&dateWord, iter, 8);
+			std::memcpy(&timeWord, iter + 11, 8);
+			dateWord -= dateTemplate;
+			timeWord -= timeTemplate;
+			const uint8_t dayHigh = static_cast<uint8_t>(iter[8] - zero);
+			const uint8_t dayLow  = static_cast<uint8_t>(iter[9] - zero);
+			if JSONIFIER_UNLIKELY ((((dateWord + digitCeiling) | dateWord | (timeWord + digitCeiling) | timeWord) & highBits) || (dateWord & dateSeparators) ||
+				(timeWord & timeSeparators) || dayHigh > 9 || dayLow > 9 || (iter[10] != 'T' && iter[10] != 't' && iter[10] != ' ')) {
+				return false;
+			}
+			dateWord = dateWord * 10 + (dateWord >> 8);
+			timeWord = timeWord * 10 + (timeWord >> 8);
+			const int64_t year{ static_cast<int64_t>((dateWord & 0xFF) * 100 + ((dateWord >> 16) & 0xFF)) };
+			const uint64_t month{ (dateWord >> 40) & 0xFF };
+			const uint64_t day{ static_cast<uint64_t>(dayHigh * 10 + dayLow) };
+			const uint64_t hour{ timeWord & 0xFF };
+			const uint64_t minute{ (timeWord >> 24) & 0xFF };
+			const uint64_t second{ (timeWord >> 48) & 0xFF };
+			if JSONIFIER_UNLIKELY (month - 1 > 11 || day - 1 >= daysInMonth(year, month) || hour > 23 || minute > 59 || second > 60) {
+				return false;
+			}
+			iter += 19;
+			uint64_t nanoseconds{};
+			if (*iter == decimal) {
+				++iter;
+				if JSONIFIER_UNLIKELY (!JSONIFIER_IS_DIGIT(*iter)) {
+					return false;
+				}
+				uint64_t digitCount{};
+				while (iter < end && JSONIFIER_IS_DIGIT(*iter)) {
+					if (digitCount < 9) {
+						nanoseconds = nanoseconds * 10 + static_cast<uint64_t>(*iter - zero);
+						++digitCount;
+					}
+					++iter;
+				}
+				nanoseconds *= pow_tables<>::powerOfTenUint[9 - digitCount];
+			}
+			int64_t offsetSeconds{};
+			if JSONIFIER_UNLIKELY (end - iter < 2) {
+				return false;
+			}
+			if (*iter == 'Z' || *iter == 'z') {
+				++iter;
+			} else if (*iter == '+' || *iter == minus) {
+				if JSONIFIER_UNLIKELY (end - iter < 7 || iter[3] != ':') {
+					return false;
+				}
+				const uint8_t offsetDigits[]{ static_cast<uint8_t>(iter[1] - zero), static_cast<uint8_t>(iter[2] - zero), static_cast<uint8_t>(iter[4] - zero),
+					static_cast<uint8_t>(iter[5] - zero) };
+				const int64_t offsetHour{ offsetDigits[0] * 10 + offsetDigits[1] };
+				const int64_t offsetMinute{ offsetDigits[2] * 10 + offsetDigits[3] };
+				if JSONIFIER_UNLIKELY (offsetDigits[0] > 9 || offsetDigits[1] > 9 || offsetDigits[2] > 9 || offsetDigits[3] > 9 || offsetHour > 23 || offsetMinute > 59) {
+					return false;
+				}
+				offsetSeconds = offsetHour * 3600 + offsetMinute * 60;
+				offsetSeconds = (*iter == minus) ? -offsetSeconds : offsetSeconds;
+				iter += 6;
+			} else {
+				return false;
+			}
+			if JSONIFIER_UNLIKELY (*iter != '"') {
+				return false;
+			}
+			iterNew = iter + 1;
+			const int64_t totalSeconds{ daysFromCivil(year, month, day) * 86400 + static_cast<int64_t>(hour * 3600 + minute * 60 + second) - offsetSeconds };
+			value = value_type{ std::chrono::duration_cast<duration_type>(std::chrono::seconds{ totalSeconds }) +
+				std::chrono::duration_cast<duration_type>(std::chrono::nanoseconds{ static_cast<int64_t>(nanoseconds) }) };
+			return true;
+		}
+	};
+
+	template<typename value_type> struct time_point_serializer {
+		using duration_type = typename value_type::duration;
+		static constexpr uint64_t fractionDigits{ fractionDigitCount<duration_type>() };
+
+		/// @brief Writes a quoted utc timestamp with as many fractional digits as the time point's duration carries, using the itoa pair and quad tables.
+		JSONIFIER_INLINE static char* impl(char* buf, const value_type& value) noexcept {
+			const auto sinceEpoch	   = value.time_since_epoch();
+			const auto wholeSeconds	   = std::chrono::floor<std::chrono::seconds>(sinceEpoch);
+			const int64_t totalSeconds = wholeSeconds.count();
+			int64_t days			   = totalSeconds / 86400;
+			int64_t secondOfDay		   = totalSeconds % 86400;
+			if (secondOfDay < 0) {
+				secondOfDay += 86400;
+				--days;
+			}
+			const civil_date date{ civilFromDays(days) };
+			*buf = '"';
+			++buf;
+			if JSONIFIER_LIKELY (date.year >= 0 && date.year <= 9999) {
+				std::memcpy(buf, fiwb<void>::charTable04.data() + date.year, 4);
+				buf += 4;
+			} else {
+				buf = to_chars<int64_t>::impl(buf, date.year);
+			}
+			*buf = minus;
+			std::memcpy(buf + 1, fiwb<void>::charTable02 + date.month, 2);
+			buf[3] = minus;
+			std::memcpy(buf + 4, fiwb<void>::charTable02 + date.day, 2);
+			buf[6] = 'T';
+			std::memcpy(buf + 7, fiwb<void>::charTable02 + secondOfDay / 3600, 2);
+			buf[9] = ':';
+			std::memcpy(buf + 10, fiwb<void>::charTable02 + (secondOfDay / 60) % 60, 2);
+			buf[12] = ':';
+			std::memcpy(buf + 13, fiwb<void>::charTable02 + secondOfDay % 60, 2);
+			buf += 15;
+			if constexpr (fractionDigits > 0) {
+				using fraction_type = std::chrono::duration<int64_t, std::ratio<1, static_cast<std::intmax_t>(pow_tables<>::powerOfTenUint[fractionDigits])>>;
+				uint64_t fraction{ static_cast<uint64_t>(std::chrono::duration_cast<fraction_type>(sinceEpoch - wholeSeconds).count()) };
+				*buf = decimal;
+				++buf;
+				char* fractionPtr{ buf + fractionDigits };
+				while (fractionPtr - buf >= 2) {
+					fractionPtr -= 2;
+					std::memcpy(fractionPtr, fiwb<void>::charTable02 + (fraction % 100), 2);
+					fraction /= 100;
+				}
+				if (fractionPtr != buf) {
+					*buf = static_cast<char>(zero + fraction);
+				}
+				buf += fractionDigits;
+			}
+			std::memcpy(buf, "Z\"", 2);
+			return buf + 2;
+		}
+	};
+
+}
@@ -182,21 +182,36 @@ namespace jsonifier {
 
 	template<typename value_type> class string_view_base;
 
-	template<typename value_type, uint64_t> class string_base;
+	struct aligned_allocator;
 
-	using string = string_base<char, 0>;
+	template<typename value_type, uint64_t, typename> class string_base;
+
+	using string = string_base<char, 0, aligned_allocator>;
 
 	using string_view = string_view_base<char>;
 
 	class raw_json_data;
 
+	template<uint64_t scale, bool quoted = false> struct decimal;
+
 	// Idea for this interface sampled from Stephen Berry and his library, Glaze library: https://github.com/stephenberry/glaze
 	template<typename value_type> struct core;
 
 	struct skip {};
 
+	/// @brief Names the members of a type that a parse should fill, as in parseJson<options, projection<&value_type::a, &value_type::b>>(value, in).
+	/// Every other member is left untouched, and the object is left behind as soon as each listed member has been read.
+	template<auto... memberPtrs> struct projection {};
+
 	namespace concepts {
 
+		template<typename value_type> struct is_projection : std::false_type {};
+
+		template<auto... memberPtrs> struct is_projection<projection<memberPtrs...>> : std::true_type {};
+
+		template<typename value_type>
+		concept projection_t = is_projection<jsonifier::internal::remove_cvref_t<value_type>>::value;
+
 		template<typename value_type>
 		concept skip_t = std::is_same_v<jsonifier::internal::remove_cvref_t<value_type>, skip>;
 
@@ -247,10 +262,19 @@ namespace jsonifier {
 		concept has_resize =
 			requires(jsonifier::internal::remove_cvref_t<value_type> value) { value.resize(typename jsonifier::internal::remove_cvref_t<value_type>::size_type{}); };
 
+		template<typename value_type>
+		concept has_resize_uninitialized =
+			requires(jsonifier::internal::remove_cvref_t<value_type> value) {
+				value.resize_uninitialized(typename jsonifier::internal::remove_cvref_t<value_type>::size_type{});
+			} && std::is_trivially_default_constructible_v<typename jsonifier::internal::remove_cvref_t<value_type>::value_type>;
+
 		template<typename value_type>
 		concept has_reserve =
 			requires(jsonifier::internal::remove_cvref_t<value_type> value) { value.reserve(typename jsonifier::internal::remove_cvref_t<value_type>::size_type{}); };
 
+		template<typename value_type>
+		concept fixed_capacity_t = requires { jsonifier::internal::remove_cvref_t<value_type>::fixedCapacity; };
+
 		template<typename value_type>
 		concept has_data = requires(jsonifier::internal::remove_cvref_t<value_type> value) {
 			{ value.data() };
@@ -405,6 +429,13 @@ namespace jsonifier {
 		template<typename value_type>
 		concept raw_json_t = std::same_as<jsonifier::internal::remove_cvref_t<value_type>, raw_json_data>;
 
+		template<typename value_type>
+		concept decimal_t = requires {
+			jsonifier::internal::remove_cvref_t<value_type>::scale;
+			jsonifier::internal::remove_cvref_t<value_type>::quoted;
+		} && std::same_as<jsonifier::internal::remove_cvref_t<value_type>,
+			decimal<jsonifier::internal::remove_cvref_t<value_type>::scale, jsonifier::internal::remove_cvref_t<value_type>::quoted>>;
+
 		template<typename value_type01, typename value_type02>
 		concept same_character_size = requires {
 			sizeof(typename jsonifier::internal::remove_cvref_t<value_type01>::value_type) == sizeof(typename jsonifier::internal::remove_cvref_t<value_type02>::value_type);
@@ -455,6 +486,10 @@ namespace jsonifier {
 		template<typename value_type>
 		concept time_t = internal::is_specialization_v<std::chrono::duration<jsonifier::internal::remove_cvref_t<value_type>>, std::chrono::duration>;
 
+		template<typename value_type>
+		concept time_point_t = internal::is_specialization_v<jsonifier::internal::remove_cvref_t<value_type>, std::chrono::time_point> &&
+			std::same_as<typename jsonifier::internal::remove_cvref_t<value_type>::clock, std::chrono::system_clock>;
+
 		template<typename value_type>
 		concept integer_t =
 			std::integral<jsonifier::internal::remove_cvref_t<value_type>> && !bool_t<value_type> && !std::floating_point<jsonifier::internal::remove_cvref_t<value_type>>;
@@ -504,6 +539,24 @@ namespace jsonifier::internal {
 		return value1 < static_cast<value_type01>(value2) ? value1 : static_cast<value_type01>(value2);
 	}
 
+	/// @brief Resizes a buffer whose new elements are about to be overwritten, skipping the value-initialization where the buffer type allows it.
+	template<typename buffer_type> JSONIFIER_INLINE void resizeUninitialized(buffer_type& buffer, uint64_t sizeNew) noexcept {
+		if constexpr (concepts::has_resize_uninitialized<buffer_type>) {
+			buffer.resize_uninitialized(sizeNew);
+		} else {
+			buffer.resize(sizeNew);
+		}
+	}
+
+	/// @brief Whether a fixed-capacity container is full; a growable one never is.
+	template<typename value_type> JSONIFIER_INLINE constexpr bool isAtCapacity(const value_type& value) noexcept {
+		if constexpr (concepts::fixed_capacity_t<value_type>) {
+			return value.size() >= remove_cvref_t<value_type>::fixedCapacity;
+		} else {
+			return false;
+		}
+	}
+
 	template<concepts::time_t value_type> class stop_watch {
 	  public:
 		using hr_clock = std::chrono::high_resolution_clock;
@@ -75,17 +75,26 @@ namespace jsonifier::internal {
 
 	template<size_t... indices> struct index_sequence {};
 
-	template<size_t index, typename index_sequence> struct make_index_sequence_impl;
+	template<typename lhs_type, typename rhs_type> struct concat_index_sequences;
 
-	template<size_t... indices> struct make_index_sequence_impl<0, index_sequence<indices...>> {
-		using type = index_sequence<indices...>;
+	template<size_t... lhsIndices, size_t... rhsIndices> struct concat_index_sequences<index_sequence<lhsIndices...>, index_sequence<rhsIndices...>> {
+		using type = index_sequence<lhsIndices..., (sizeof...(lhsIndices) + rhsIndices)...>;
 	};
 
-	template<size_t index, size_t... indices> struct make_index_sequence_impl<index, index_sequence<indices...>> {
-		using type = typename make_index_sequence_impl<index - 1, index_sequence<index - 1, indices...>>::type;
+	/// @brief Built by halving, so the instantiation depth grows with log2(index) and types with many hundreds of members stay within the compiler's limit.
+	template<size_t index> struct make_index_sequence_impl {
+		using type = typename concat_index_sequences<typename make_index_sequence_impl<index / 2>::type, typename make_index_sequence_impl<index - index / 2>::type>::type;
 	};
 
-	template<size_t index> using make_index_sequence = typename make_index_sequence_impl<index, index_sequence<>>::type;
+	template<> struct make_index_sequence_impl<0> {
+		using type = index_sequence<>;
+	};
+
+	template<> struct make_index_sequence_impl<1> {
+		using type = index_sequence<0>;
+	};
+
+	template<size_t index> using make_index_sequence = typename make_index_sequence_impl<index>::type;
 
 	template<class value_type_new, value_type_new valueNew> struct integral_constant {
 		static constexpr value_type_new value = valueNew;
@@ -23,15 +23,17 @@
 /// Feb 20, 2023
 #pragma once
 
-#include <jsonifier/Utilities/Allocator.hpp>
-#include <jsonifier/Utilities/Iterator.hpp>
+#include <jsonifier/Containers/Allocator.hpp>
+#include <jsonifier/Containers/Iterator.hpp>
 #include <jsonifier/Utilities/Compare.hpp>
 
 namespace jsonifier {
 
-	template<typename derived_type, uint64_t = 0> class vector;
+	template<typename derived_type, uint64_t = 0, typename = aligned_allocator> class vector;
 
-	template<typename value_type_new, uint64_t sizeValNewer> class vector : protected std::equal_to<value_type_new>, protected internal::alloc_wrapper<value_type_new> {
+	/// @brief A growable array over allocator_type storage; see aligned_allocator for what an allocator needs to provide.
+	template<typename value_type_new, uint64_t sizeValNewer, typename allocator_type> class vector : protected std::equal_to<value_type_new>,
+																									protected internal::alloc_wrapper<value_type_new, allocator_type> {
 	  public:
 		using value_type			 = value_type_new;
 		using pointer				 = value_type*;
@@ -45,14 +47,19 @@ namespace jsonifier {
 		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 		using object_compare		 = std::equal_to<value_type>;
 		using size_type				 = size_t;
-		using allocator				 = internal::alloc_wrapper<value_type>;
+		using allocator				 = internal::alloc_wrapper<value_type, allocator_type>;
 
-		vector() noexcept {
+		vector() noexcept(sizeValNewer == 0) {
 			if constexpr (sizeValNewer > 0) {
 				reserve(sizeValNewer);
 			}
 		}
 
+		explicit vector(const allocator_type& allocatorNew) noexcept : allocator{ allocatorNew } {
+		}
+
+		using allocator::getAllocator;
+
 		template<typename value_type_newer> vector(size_type sizeNew, value_type_newer&& values) : capacityVal{}, sizeVal{}, dataVal{} {
 			auto sizeValNew = sizeNew;
 			if (sizeValNew > 0 && sizeValNew < maxSize()) {
@@ -64,7 +71,7 @@ namespace jsonifier {
 
 		vector& operator=(vector&& other) noexcept {
 			if (this != &other && dataVal != other.dataVal) {
-				vector{ other }.swap(*this);
+				vector{ internal::move(other) }.swap(*this);
 			}
 			return *this;
 		}
@@ -73,14 +80,14 @@ namespace jsonifier {
 			swap(other);
 		}
 
-		vector& operator=(const vector& other) noexcept {
+		vector& operator=(const vector& other) {
 			if (this != &other) {
 				vector{ other }.swap(*this);
 			}
 			return *this;
 		}
 
-		vector(const vector& other) : capacityVal{}, sizeVal{}, dataVal{} {
+		vector(const vector& other) : allocator{ other.getAllocator() }, capacityVal{}, sizeVal{}, dataVal{} {
 			auto sizeValNew = other.size();
 			if (sizeValNew > 0 && sizeValNew < maxSize()) {
 				reserve(sizeValNew);
@@ -89,12 +96,12 @@ namespace jsonifier {
 			}
 		}
 
-		vector& operator=(std::vector<value_type>&& other) noexcept {
+		vector& operator=(std::vector<value_type>&& other) {
 			vector{ other }.swap(*this);
 			return *this;
 		}
 
-		explicit vector(std::vector<value_type>&& other) noexcept : capacityVal{}, sizeVal{}, dataVal{} {
+		explicit vector(std::vector<value_type>&& other) : capacityVal{}, sizeVal{}, dataVal{} {
 			auto sizeValNew = other.size();
 			if (sizeValNew > 0 && sizeValNew < maxSize()) {
 				reserve(sizeValNew);
@@ -103,7 +110,7 @@ namespace jsonifier {
 			}
 		}
 
-		vector& operator=(const std::vector<value_type>& other) noexcept {
+		vector& operator=(const std::vector<value_type>& other) {
 			vector{ other }.swap(*this);
 			return *this;
 		}
@@ -117,7 +124,7 @@ namespace jsonifier {
 			}
 		}
 
-		vector(iterator first, iterator last) noexcept {
+		vector(iterator first, iterator last) {
 			difference_type insertCount = std::distance(first, last);
 			if (!first) {
 				return;
@@ -142,7 +149,7 @@ namespace jsonifier {
 			sizeVal = newSize;
 		}
 
-		vector& operator=(std::initializer_list<value_type> other) noexcept {
+		vector& operator=(std::initializer_list<value_type> other) {
 			vector{ other }.swap(*this);
 			return *this;
 		}
@@ -156,7 +163,7 @@ namespace jsonifier {
 			}
 		}
 
-		vector& operator=(const value_type& other) noexcept {
+		vector& operator=(const value_type& other) {
 			emplace_back(other);
 			return *this;
 		}
@@ -165,7 +172,7 @@ namespace jsonifier {
 			*this = other;
 		}
 
-		template<typename... arg_types> void assign(size_type count, arg_types&&... newValue) noexcept {
+		template<typename... arg_types> void assign(size_type count, arg_types&&... newValue) {
 			size_type newSize = sizeVal + count;
 
 			if (newSize > capacityVal) {
@@ -177,7 +184,7 @@ namespace jsonifier {
 			sizeVal = newSize;
 		}
 
-		void insert(iterator where, iterator first, iterator last) noexcept {
+		void insert(iterator where, iterator first, iterator last) {
 			size_type insertCount = std::distance(first, last);
 
 			if (insertCount == 0) {
@@ -319,7 +326,7 @@ namespace jsonifier {
 			return returnValue;
 		}
 
-		template<typename... value_types> reference emplace_back(value_types&&... c) noexcept {
+		template<typename... value_types> reference emplace_back(value_types&&... c) {
 			if (sizeVal + 1 >= capacityVal) {
 				reserve(capacityVal * 2 + 2);
 			}
@@ -328,7 +335,7 @@ namespace jsonifier {
 			return dataVal[sizeVal - 1];
 		}
 
-		reference emplace_back(value_type&& c) noexcept {
+		reference emplace_back(value_type&& c) {
 			if (sizeVal + 1 >= capacityVal) {
 				reserve(capacityVal * 2 + 2);
 			}
@@ -337,7 +344,7 @@ namespace jsonifier {
 			return dataVal[sizeVal - 1];
 		}
 
-		reference emplace_back(const value_type& c) noexcept {
+		reference emplace_back(const value_type& c) {
 			if (sizeVal + 1 >= capacityVal) {
 				reserve(capacityVal * 2 + 2);
 			}
@@ -375,12 +382,12 @@ namespace jsonifier {
 			return iterator{ dataVal + eraseIndex };
 		}
 
-		void shrink_to_fit() noexcept {
+		void shrink_to_fit() {
 			if (sizeVal == capacityVal) {
 				return;
 			}
 
-			vector<value_type> newVector{};
+			vector newVector{ getAllocator() };
 			newVector.reserve(sizeVal);
 			std::uninitialized_move(dataVal, dataVal + sizeVal, newVector.data());
 			newVector.sizeVal = sizeVal;
@@ -394,44 +401,70 @@ namespace jsonifier {
 		void resize(size_type newSize) {
 			if JSONIFIER_LIKELY (newSize > capacityVal) {
 				pointer newPtr = allocator::allocate(newSize);
+				if JSONIFIER_UNLIKELY (!newPtr) {
+					throw std::bad_alloc{};
+				}
 				try {
 					if (sizeVal > 0ull) {
-						if constexpr (std::is_copy_constructible_v<value_type>) {
-							std::uninitialized_copy(dataVal, dataVal + sizeVal, newPtr);
-						} else if constexpr (std::is_move_constructible_v<value_type>) {
+						if constexpr (std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>) {
 							std::uninitialized_move(dataVal, dataVal + sizeVal, newPtr);
+							std::destroy(dataVal, dataVal + sizeVal);
+						} else {
+							std::uninitialized_copy(dataVal, dataVal + sizeVal, newPtr);
+							std::destroy(dataVal, dataVal + sizeVal);
 						}
 					}
 					if JSONIFIER_LIKELY (dataVal && capacityVal > 0) {
-						allocator::deallocate(dataVal);
+						allocator::deallocate(dataVal, capacityVal);
 					}
 				} catch (...) {
-					allocator::deallocate(newPtr);
+					allocator::deallocate(newPtr, newSize);
 					throw;
 				}
 				capacityVal = newSize;
 				dataVal		= newPtr;
-				std::uninitialized_value_construct(dataVal + sizeVal, dataVal + capacityVal);
+				std::uninitialized_value_construct(dataVal + sizeVal, dataVal + newSize);
 			} else if JSONIFIER_UNLIKELY (newSize > sizeVal) {
-				std::uninitialized_value_construct(dataVal + sizeVal, dataVal + capacityVal);
+				std::uninitialized_value_construct(dataVal + sizeVal, dataVal + newSize);
 			} else if (newSize < sizeVal) {
 				std::destroy(dataVal + newSize, dataVal + sizeVal);
 			}
 			sizeVal = newSize;
 		}
 
+		/// @brief Resizes like resize, but leaves any elements past the old size unset, for callers that are about to overwrite them.
+		void resize_uninitialized(size_type newSize) {
+			static_assert(std::is_trivially_default_constructible_v<value_type> && std::is_trivially_destructible_v<value_type>,
+				"Sorry, but resize_uninitialized is only available for trivially constructible and destructible element types.");
+			if (newSize > capacityVal) {
+				reserve(newSize);
+			}
+			sizeVal = newSize;
+		}
+
+		/// @brief Grows the vector by count unset elements and returns a pointer to the first of them.
+		pointer append_uninitialized(size_type count) {
+			const size_type oldSize{ sizeVal };
+			resize_uninitialized(sizeVal + count);
+			return dataVal + oldSize;
+		}
+
 		void reserve(size_type capacityNew) {
 			if JSONIFIER_LIKELY (capacityNew > capacityVal) {
 				pointer newPtr = allocator::allocate(capacityNew);
+				if JSONIFIER_UNLIKELY (!newPtr) {
+					throw std::bad_alloc{};
+				}
 				try {
 					if JSONIFIER_LIKELY (dataVal && capacityVal > 0) {
 						if (sizeVal > 0) {
 							std::uninitialized_move(dataVal, dataVal + sizeVal, newPtr);
+							std::destroy(dataVal, dataVal + sizeVal);
 						}
-						allocator::deallocate(dataVal);
+						allocator::deallocate(dataVal, capacityVal);
 					}
 				} catch (...) {
-					allocator::deallocate(newPtr);
+					allocator::deallocate(newPtr, capacityNew);
 					throw;
 				}
 				capacityVal = capacityNew;
@@ -445,6 +478,7 @@ namespace jsonifier {
 		}
 
 		void swap(vector& other) noexcept {
+			allocator::swapAllocator(other);
 			std::swap(capacityVal, other.capacityVal);
 			std::swap(sizeVal, other.sizeVal);
 			std::swap(dataVal, other.dataVal);
@@ -481,7 +515,7 @@ namespace jsonifier {
 					std::destroy(dataVal, dataVal + sizeVal);
 					sizeVal = 0;
 				}
-				allocator::deallocate(dataVal);
+				allocator::deallocate(dataVal, capacityVal);
 				dataVal		= nullptr;
 				capacityVal = 0;
 			}
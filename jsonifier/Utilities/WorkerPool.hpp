@@ -0,0 +1,159 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// Oct 18, 2026
+#pragma once
+
+#include <jsonifier/Utilities/TypeEntities.hpp>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+namespace jsonifier::internal {
+
+	/// @brief Process-wide set of worker threads for splitting one large minify or prettify call across cores.
+	/// Jobs are run one at a time; the calling thread takes part in its own job and returns once every index has completed.
+	class worker_pool {
+	  public:
+		worker_pool& operator=(const worker_pool&) = delete;
+		worker_pool(const worker_pool&)			   = delete;
+
+		static worker_pool& getInstance() noexcept {
+			static worker_pool pool{};
+			return pool;
+		}
+
+		uint64_t getThreadCount() const noexcept {
+			return workers.size() + 1;
+		}
+
+		/// @brief Calls function(index) for every index in [0, count), spread over the workers and the calling thread.
+		template<typename function_type> void forEach(uint64_t count, function_type&& function) noexcept {
+			std::unique_lock dispatchLock{ dispatchMutex };
+			{
+				std::unique_lock lock{ stateMutex };
+				invoke = [](void* context, uint64_t index) {
+					(*static_cast<jsonifier::internal::remove_reference_t<function_type>*>(context))(index);
+				};
+				invokeContext = &function;
+				jobCount	  = count;
+				remaining	  = count;
+				nextIndex.store(0, std::memory_order_relaxed);
+				jobOpen = true;
+				++generation;
+			}
+			workAvailable.notify_all();
+			runJob(invoke, invokeContext);
+			std::unique_lock lock{ stateMutex };
+			workDone.wait(lock, [this] {
+				return remaining == 0 && activeWorkers == 0;
+			});
+			jobOpen = false;
+		}
+
+		~worker_pool() noexcept {
+			{
+				std::unique_lock lock{ stateMutex };
+				stopping = true;
+			}
+			workAvailable.notify_all();
+			for (auto& worker: workers) {
+				worker.join();
+			}
+		}
+
+	  protected:
+		using invoke_type = void (*)(void*, uint64_t);
+
+		std::condition_variable workAvailable{};
+		std::condition_variable workDone{};
+		std::atomic<uint64_t> nextIndex{};
+		std::vector<std::thread> workers{};
+		std::mutex dispatchMutex{};
+		std::mutex stateMutex{};
+		invoke_type invoke{};
+		void* invokeContext{};
+		uint64_t activeWorkers{};
+		uint64_t generation{};
+		uint64_t remaining{};
+		uint64_t jobCount{};
+		bool stopping{};
+		bool jobOpen{};
+
+		worker_pool() noexcept {
+			const uint64_t threadCount{ std::thread::hardware_concurrency() };
+			for (uint64_t x = 1; x < threadCount; ++x) {
+				workers.emplace_back([this] {
+					workerLoop();
+				});
+			}
+		}
+
+		void workerLoop() noexcept {
+			uint64_t seenGeneration{};
+			while (true) {
+				invoke_type invokeNew{};
+				void* contextNew{};
+				{
+					std::unique_lock lock{ stateMutex };
+					workAvailable.wait(lock, [&] {
+						return stopping || generation != seenGeneration;
+					});
+					if (stopping) {
+						return;
+					}
+					seenGeneration = generation;
+					if (!jobOpen) {
+						continue;
+					}
+					invokeNew  = invoke;
+					contextNew = invokeContext;
+					++activeWorkers;
+				}
+				runJob(invokeNew, contextNew);
+				{
+					std::unique_lock lock{ stateMutex };
+					--activeWorkers;
+				}
+				workDone.notify_all();
+			}
+		}
+
+		void runJob(invoke_type invokeNew, void* contextNew) noexcept {
+			uint64_t index{ nextIndex.fetch_add(1, std::memory_order_relaxed) };
+			while (index < jobCount) {
+				invokeNew(contextNew, index);
+				bool finished{};
+				{
+					std::unique_lock lock{ stateMutex };
+					finished = --remaining == 0;
+				}
+				if (finished) {
+					workDone.notify_all();
+				}
+				index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	};
+
+}